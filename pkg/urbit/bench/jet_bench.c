@@ -0,0 +1,476 @@
+/* bench/jet_bench.c: jets against the hoon arms they replace.
+**
+**   each case wishes a gate from the ivory kernel and slams it with
+**   generated samples, first with every jet enabled, then with every
+**   jet disabled (so that the arms run as nock). the products must
+**   agree; ns/op and the speedup of the jet are reported.
+**
+**   usage: jet_bench [-v] [case ...]
+**
+**     -v      also list the jet arms no case exercised
+**     case    run only cases whose name contains this string
+**
+**   exits nonzero if any jet disagrees with its arm.
+*/
+#include "all.h"
+#include "ur/ur.h"
+#include "vere/ivory.h"
+#include "vere/vere.h"
+
+/* _jb_case: one benchmark: a gate, and a sample generator.
+*/
+typedef struct {
+  c3_c*   nam_c;                      //  case name
+  c3_c*   gat_c;                      //  hoon for the gate
+  u3_noun (*sam_f)(void);             //  produce a sample
+  c3_w    len_w;                      //  samples
+} _jb_case;
+
+//  minimum time per timed run, in ns
+//
+#define JB_MIN_NS  20000000ULL
+
+static c3_d _jb_sed_d = 0x9e3779b97f4a7c15ULL;  //  prng state
+
+/* _setup(): prepare for benchmarks.
+*/
+static void
+_setup(void)
+{
+  c3_d          len_d = u3_Ivory_pill_len;
+  c3_y*         byt_y = u3_Ivory_pill;
+  u3_cue_xeno*  sil_u;
+  u3_weak       pil;
+
+  u3C.wag_w |= u3o_hashless;
+  u3m_boot_lite();
+  sil_u = u3s_cue_xeno_init_with(ur_fib27, ur_fib28);
+  if ( u3_none == (pil = u3s_cue_xeno_with(sil_u, len_d, byt_y)) ) {
+    fprintf(stderr, "jet bench: ivory cue failed\r\n");
+    exit(1);
+  }
+  u3s_cue_xeno_done(sil_u);
+  if ( c3n == u3v_boot_lite(pil) ) {
+    fprintf(stderr, "jet bench: ivory boot failed\r\n");
+    exit(1);
+  }
+}
+
+/* _jb_time(): monotonic nanoseconds.
+*/
+static c3_d
+_jb_time(void)
+{
+  struct timespec tim_u;
+
+  clock_gettime(CLOCK_MONOTONIC, &tim_u);
+  return (c3_d)tim_u.tv_sec * 1000000000ULL + (c3_d)tim_u.tv_nsec;
+}
+
+/* _jb_rand(): next pseudorandom chub (xorshift64*), reproducibly.
+*/
+static c3_d
+_jb_rand(void)
+{
+  _jb_sed_d ^= _jb_sed_d >> 12;
+  _jb_sed_d ^= _jb_sed_d << 25;
+  _jb_sed_d ^= _jb_sed_d >> 27;
+  return _jb_sed_d * 0x2545f4914f6cdd1dULL;
+}
+
+/* _jb_below(): pseudorandom chub below max_d (nonzero).
+*/
+static c3_d
+_jb_below(c3_d max_d)
+{
+  return _jb_rand() % max_d;
+}
+
+/* _jb_atom(): pseudorandom atom of at most bit_w bits.
+*/
+static u3_atom
+_jb_atom(c3_w bit_w)
+{
+  c3_w  len_w = (bit_w + 63) >> 6;
+  c3_d* buf_d = c3_malloc(sizeof(c3_d) * (len_w + 1));
+  c3_w  i_w;
+  u3_atom pro;
+
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    buf_d[i_w] = _jb_rand();
+  }
+
+  if ( bit_w & 63 ) {
+    buf_d[len_w - 1] &= (1ULL << (bit_w & 63)) - 1;
+  }
+
+  pro = u3i_chubs(len_w, buf_d);
+  c3_free(buf_d);
+  return pro;
+}
+
+/* _jb_list(): pseudorandom list of len_w atoms of at most bit_w bits.
+*/
+static u3_noun
+_jb_list(c3_w len_w, c3_w bit_w)
+{
+  u3_noun pro = u3_nul;
+
+  while ( len_w-- ) {
+    pro = u3nc(_jb_atom(bit_w), pro);
+  }
+  return pro;
+}
+
+/* _jb_map(): pseudorandom (map @ @) of up to len_w small keys.
+*/
+static u3_noun
+_jb_map(c3_w len_w)
+{
+  u3_noun pro = u3_nul;
+
+  while ( len_w-- ) {
+    pro = u3kdb_put(pro, _jb_atom(12), _jb_atom(32));
+  }
+  return pro;
+}
+
+/* _jb_set(): pseudorandom (set @) of up to len_w small keys.
+*/
+static u3_noun
+_jb_set(c3_w len_w)
+{
+  u3_noun pro = u3_nul;
+
+  while ( len_w-- ) {
+    pro = u3kdi_put(pro, _jb_atom(12));
+  }
+  return pro;
+}
+
+/* _jb_tree(): pseudorandom noun of up to dep_w levels.
+*/
+static u3_noun
+_jb_tree(c3_w dep_w)
+{
+  if ( !dep_w || !_jb_below(3) ) {
+    return _jb_atom(1 + _jb_below(96));
+  }
+  return u3nc(_jb_tree(dep_w - 1), _jb_tree(dep_w - 1));
+}
+
+/*  sample generators. arithmetic is O(n) or worse in nock, so
+**  operands are kept small enough for the arms to finish.
+*/
+static u3_noun _jb_two_small(void)
+  { return u3nc(_jb_atom(8), _jb_atom(8)); }
+static u3_noun _jb_two_tiny(void)
+  { return u3nc(_jb_atom(5), _jb_atom(5)); }
+static u3_noun _jb_one_nonzero(void)
+  { return 1 + _jb_below(255); }
+static u3_noun _jb_sub(void)
+  { c3_w a_w = _jb_below(256); return u3nc(a_w, _jb_below(a_w + 1)); }
+static u3_noun _jb_div(void)
+  { return u3nc(_jb_atom(10), 1 + _jb_below(31)); }
+static u3_noun _jb_two_wide(void)
+  { return u3nc(_jb_atom(64), _jb_atom(64)); }
+static u3_noun _jb_bloq_atom(void)
+  { return u3nc(_jb_below(4), _jb_atom(64)); }
+static u3_noun _jb_cut(void)
+  { return u3nt(_jb_below(4), u3nc(_jb_below(8), _jb_below(8)), _jb_atom(64)); }
+static u3_noun _jb_cat(void)
+  { return u3nt(_jb_below(4), _jb_atom(32), _jb_atom(32)); }
+static u3_noun _jb_rap(void)
+  { return u3nc(3, _jb_list(8, 8)); }
+static u3_noun _jb_noun(void)
+  { return _jb_tree(3); }
+static u3_noun _jb_two_nouns(void)
+  { return u3nc(_jb_tree(2), _jb_tree(2)); }
+static u3_noun _jb_bytes(void)
+  { return _jb_atom(64); }
+static u3_noun _jb_list_short(void)
+  { return _jb_list(32, 16); }
+static u3_noun _jb_two_lists(void)
+  { return u3nc(_jb_list(16, 16), _jb_list(16, 16)); }
+static u3_noun _jb_snag(void)
+  { return u3nc(_jb_below(16), _jb_list(16, 16)); }
+static u3_noun _jb_sort(void)
+  { return _jb_list(48, 16); }
+static u3_noun _jb_by_put(void)
+  { return u3nt(_jb_map(48), _jb_atom(12), _jb_atom(32)); }
+static u3_noun _jb_by_get(void)
+  { return u3nc(_jb_map(48), _jb_atom(12)); }
+static u3_noun _jb_by_map(void)
+  { return _jb_map(48); }
+static u3_noun _jb_in_put(void)
+  { return u3nc(_jb_set(48), _jb_atom(12)); }
+static u3_noun _jb_in_set(void)
+  { return _jb_set(48); }
+static u3_noun _jb_in_gas(void)
+  { return u3nc(_jb_set(48), _jb_list(256, 16)); }
+
+static _jb_case _jb_cases[] = {
+  { "add",     "add",     _jb_two_small,   64 },
+  { "sub",     "sub",     _jb_sub,         64 },
+  { "mul",     "mul",     _jb_two_tiny,    64 },
+  { "div",     "div",     _jb_div,         64 },
+  { "mod",     "mod",     _jb_div,         64 },
+  { "dec",     "dec",     _jb_one_nonzero, 64 },
+  { "gth",     "gth",     _jb_two_small,   64 },
+  { "lth",     "lth",     _jb_two_small,   64 },
+  { "met",     "met",     _jb_bloq_atom,   64 },
+  { "end",     "end",     _jb_bloq_atom,   64 },
+  { "lsh",     "lsh",     _jb_bloq_atom,   64 },
+  { "rsh",     "rsh",     _jb_bloq_atom,   64 },
+  { "cut",     "cut",     _jb_cut,         64 },
+  { "cat",     "cat",     _jb_cat,         64 },
+  { "rip",     "rip",     _jb_bloq_atom,   32 },
+  { "rap",     "rap",     _jb_rap,         32 },
+  { "mix",     "mix",     _jb_two_wide,    64 },
+  { "dis",     "dis",     _jb_two_wide,    64 },
+  { "con",     "con",     _jb_two_wide,    64 },
+  { "mug",     "mug",     _jb_noun,        16 },
+  { "gor",     "gor",     _jb_two_nouns,   16 },
+  { "mor",     "mor",     _jb_two_nouns,   16 },
+  { "dor",     "dor",     _jb_two_nouns,   16 },
+  { "shax",    "shax",    _jb_bytes,        2 },
+  { "flop",    "flop",    _jb_list_short,  32 },
+  { "lent",    "lent",    _jb_list_short,  32 },
+  { "weld",    "weld",    _jb_two_lists,   32 },
+  { "snag",    "snag",    _jb_snag,        32 },
+  { "slag",    "slag",    _jb_snag,        32 },
+  { "scag",    "scag",    _jb_snag,        32 },
+  { "sort",    "|=(a=(list @) (sort a lth))",                _jb_sort, 8 },
+  { "put:by",  "|=([a=(map @ @) b=@ c=@] (~(put by a) b c))", _jb_by_put, 16 },
+  { "get:by",  "|=([a=(map @ @) b=@] (~(get by a) b))",      _jb_by_get, 16 },
+  { "has:by",  "|=([a=(map @ @) b=@] (~(has by a) b))",      _jb_by_get, 16 },
+  { "del:by",  "|=([a=(map @ @) b=@] (~(del by a) b))",      _jb_by_get, 16 },
+  { "tap:by",  "|=(a=(map @ @) ~(tap by a))",                _jb_by_map, 16 },
+  { "wyt:by",  "|=(a=(map @ @) ~(wyt by a))",                _jb_by_map, 16 },
+  { "rep:by",  "|=(a=(map @ @) (~(rep by a) |=([[@ q=@] r=@] (mix q r))))",
+                                                              _jb_by_map, 16 },
+  { "put:in",  "|=([a=(set @) b=@] (~(put in a) b))",        _jb_in_put, 16 },
+  { "has:in",  "|=([a=(set @) b=@] (~(has in a) b))",        _jb_in_put, 16 },
+  { "tap:in",  "|=(a=(set @) ~(tap in a))",                  _jb_in_set, 16 },
+  { "gas:in",  "|=([a=(set @) b=(list @)] (~(gas in a) b))", _jb_in_gas,  4 },
+  {}
+};
+
+/* _jb_walk(): apply fun_f to every jet arm in the dashboard.
+*/
+static void
+_jb_walk(u3j_core* dev_u, void (*fun_f)(u3j_core*, u3j_harm*, void*), void* ptr_v)
+{
+  c3_w i_w, j_w;
+
+  for ( i_w = 0; dev_u && dev_u[i_w].cos_c; i_w++ ) {
+    u3j_core* cop_u = &dev_u[i_w];
+
+    for ( j_w = 0; cop_u->arm_u && cop_u->arm_u[j_w].fcs_c; j_w++ ) {
+      fun_f(cop_u, &(cop_u->arm_u[j_w]), ptr_v);
+    }
+    _jb_walk(cop_u->dev_u, fun_f, ptr_v);
+  }
+}
+
+/* _jb_live_cb(): enable or disable one jet arm.
+*/
+static void
+_jb_live_cb(u3j_core* cop_u, u3j_harm* ham_u, void* ptr_v)
+{
+  ham_u->liv = *(c3_o*)ptr_v;
+}
+
+/* _jb_live(): enable or disable every jet.
+*/
+static void
+_jb_live(c3_o liv_o)
+{
+  _jb_walk(u3D.dev_u, _jb_live_cb, &liv_o);
+}
+
+/* _jb_cove: jet arm coverage.
+*/
+typedef struct {
+  c3_o  ver_o;                        //  list unexercised arms
+  c3_w  all_w;                        //  arms with drivers
+  c3_w  hit_w;                        //  arms exercised
+} _jb_cove;
+
+/* _jb_cove_cb(): count one jet arm, if a driver.
+**
+**   arm lists may be shared between dashboard cores; an arm
+**   may be counted more than once.
+*/
+static void
+_jb_cove_cb(u3j_core* cop_u, u3j_harm* ham_u, void* ptr_v)
+{
+  _jb_cove* cov_u = ptr_v;
+
+  if ( !ham_u->fun_f ) {
+    return;
+  }
+
+  cov_u->all_w++;
+
+  if ( ham_u->cal_d ) {
+    cov_u->hit_w++;
+  }
+  else if ( c3y == cov_u->ver_o ) {
+    fprintf(stderr, "  unexercised: %s %s\r\n", cop_u->cos_c, ham_u->fcs_c);
+  }
+}
+
+/* _jb_run(): slam gat with each of len_w samples, producing ns.
+**            if pro is nonzero, products are saved there.
+*/
+static c3_d
+_jb_run(u3_noun gat, c3_w len_w, u3_noun* sam, u3_noun* pro)
+{
+  c3_d now_d = _jb_time();
+  c3_w i_w;
+
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    u3_noun out = u3n_slam_on(u3k(gat), u3k(sam[i_w]));
+
+    if ( pro ) {
+      pro[i_w] = out;
+    }
+    else {
+      u3z(out);
+    }
+  }
+
+  return _jb_time() - now_d;
+}
+
+/* _jb_time_run(): time gat over all samples, producing ns per slam.
+**                 products of the first pass are saved in pro.
+*/
+static c3_d
+_jb_time_run(u3_noun gat, c3_w len_w, u3_noun* sam, u3_noun* pro)
+{
+  c3_d tim_d = _jb_run(gat, len_w, sam, pro);
+  c3_w rep_w = 1;
+
+  while ( tim_d < JB_MIN_NS ) {
+    tim_d += _jb_run(gat, len_w, sam, 0);
+    rep_w++;
+  }
+
+  return tim_d / ((c3_d)rep_w * len_w);
+}
+
+/* _jb_case_run(): run one case, producing yes if jets and nock agree.
+*/
+static c3_o
+_jb_case_run(_jb_case* cas_u)
+{
+  u3_noun  gat = u3v_wish(cas_u->gat_c);
+  u3_noun* sam = c3_malloc(sizeof(u3_noun) * cas_u->len_w);
+  u3_noun* jet = c3_malloc(sizeof(u3_noun) * cas_u->len_w);
+  u3_noun* noc = c3_malloc(sizeof(u3_noun) * cas_u->len_w);
+  c3_o     ret_o = c3y;
+  c3_d     jet_d, noc_d;
+  c3_w     i_w;
+
+  for ( i_w = 0; i_w < cas_u->len_w; i_w++ ) {
+    sam[i_w] = cas_u->sam_f();
+  }
+
+  _jb_live(c3y);
+  jet_d = _jb_time_run(gat, cas_u->len_w, sam, jet);
+
+  _jb_live(c3n);
+  noc_d = _jb_time_run(gat, cas_u->len_w, sam, noc);
+  _jb_live(c3y);
+
+  for ( i_w = 0; i_w < cas_u->len_w; i_w++ ) {
+    if ( c3n == u3r_sing(jet[i_w], noc[i_w]) ) {
+      fprintf(stderr, "  %s: mismatch on sample %u: jet %x, nock %x\r\n",
+                      cas_u->nam_c, i_w,
+                      u3r_mug(jet[i_w]), u3r_mug(noc[i_w]));
+      ret_o = c3n;
+    }
+    u3z(sam[i_w]);
+    u3z(jet[i_w]);
+    u3z(noc[i_w]);
+  }
+
+  fprintf(stderr, "  %-8s jet %10" PRIu64 " ns/op, nock %12" PRIu64
+                  " ns/op, %9.1fx%s\r\n",
+                  cas_u->nam_c, jet_d, noc_d,
+                  jet_d ? (double)noc_d / jet_d : 0.0,
+                  ( c3y == ret_o ) ? "" : "  MISMATCH");
+
+  c3_free(sam);
+  c3_free(jet);
+  c3_free(noc);
+  u3z(gat);
+  return ret_o;
+}
+
+/* _jb_pick(): yes if a case is selected by the arguments.
+*/
+static c3_o
+_jb_pick(_jb_case* cas_u, c3_i argc, c3_c* argv[])
+{
+  c3_i i_i, any_i = 0;
+
+  for ( i_i = 1; i_i < argc; i_i++ ) {
+    if ( !strcmp("-v", argv[i_i]) ) {
+      continue;
+    }
+    any_i = 1;
+
+    if ( strstr(cas_u->nam_c, argv[i_i]) ) {
+      return c3y;
+    }
+  }
+
+  return any_i ? c3n : c3y;
+}
+
+/* main(): run all benchmarks
+*/
+int
+main(int argc, char* argv[])
+{
+  _jb_case* cas_u;
+  _jb_cove  cov_u = { c3n, 0, 0 };
+  c3_w      bad_w = 0;
+  c3_i      i_i;
+
+  for ( i_i = 1; i_i < argc; i_i++ ) {
+    if ( !strcmp("-v", argv[i_i]) ) {
+      cov_u.ver_o = c3y;
+    }
+  }
+
+  _setup();
+
+  fprintf(stderr, "\r\njet vs. nock benchmark:\r\n");
+
+  for ( cas_u = _jb_cases; cas_u->nam_c; cas_u++ ) {
+    if ( c3y == _jb_pick(cas_u, argc, argv) ) {
+      if ( c3n == _jb_case_run(cas_u) ) {
+        bad_w++;
+      }
+    }
+  }
+
+  _jb_walk(u3D.dev_u, _jb_cove_cb, &cov_u);
+  fprintf(stderr, "\r\njet arms exercised: %u of %u\r\n",
+                  cov_u.hit_w, cov_u.all_w);
+
+  if ( bad_w ) {
+    fprintf(stderr, "jet bench: %u cases mismatched\r\n", bad_w);
+    return 1;
+  }
+
+  //  GC
+  //
+  u3m_grab(u3_none);
+
+  return 0;
+}
@@ -153,6 +153,7 @@ _main_init(void)
 
   u3_Host.ops_u.net = c3y;
   u3_Host.ops_u.lit = c3n;
+  u3_Host.ops_u.mem = c3n;
   u3_Host.ops_u.nuu = c3n;
   u3_Host.ops_u.pro = c3n;
   u3_Host.ops_u.qui = c3n;
@@ -223,6 +224,7 @@ _main_getopt(c3_i argc, c3_c** argv)
     { "ames-port",           required_argument, NULL, 'p' },
     { "http-port",           required_argument, NULL, c3__http },
     { "https-port",          required_argument, NULL, c3__htls },
+    { "keep-memo",           no_argument,       NULL, c3__memo },
     { "no-conn",             no_argument,       NULL, c3__noco },
     { "no-dock",             no_argument,       NULL, c3__nodo },
     { "quiet",               no_argument,       NULL, 'q' },
@@ -346,6 +348,10 @@ _main_getopt(c3_i argc, c3_c** argv)
         } else u3_Host.ops_u.pes_s = arg_w;
         break;
       }
+      case c3__memo: {
+        u3_Host.ops_u.mem = c3y;
+        break;
+      }
       case c3__noco: {
         u3_Host.ops_u.con = c3n;
         break;
@@ -680,6 +686,7 @@ u3_ve_usage(c3_i argc, c3_c** argv)
     "-x, --exit                    Exit immediately\n",
     "-Y, --scry-into FILE          Optional name of file (for -X)\n",
     "-Z, --scry-format FORMAT      Optional file format ('jam', or aura, for -X)\n",
+    "    --keep-memo               Keep %%memo results across events\n",
     "    --no-conn                 Do not run control plane\n",
     "\n",
     "Development Usage:\n",
@@ -1775,6 +1782,12 @@ main(c3_i   argc,
         u3C.wag_w |= u3o_debug_cpu;
       }
 
+      /*  Set %memo persistence flag.
+      */
+      if ( _(u3_Host.ops_u.mem) ) {
+        u3C.wag_w |= u3o_memo_keep;
+      }
+
       /*  Set verbose flag.
       */
       if ( _(u3_Host.ops_u.veb) ) {
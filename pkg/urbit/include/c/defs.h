@@ -50,6 +50,7 @@
     /* Bit counting.
     */
 #     define c3_bits_word(w) ((w) ? (32 - __builtin_clz(w)) : 0)
+#     define c3_bits_dword(w) ((w) ? (64 - __builtin_clzll(w)) : 0)
 
     /* Min and max.
     */
@@ -608,6 +608,7 @@
 #   define c3__jato   c3_s4('j','a','t','o')
 #   define c3__jet    c3_s3('j','e','t')
 #   define c3__jetd   c3_s4('j','e','t','d')
+#   define c3__jets   c3_s4('j','e','t','s')
 #   define c3__just   c3_s4('j','u','s','t')
 #   define c3__k      c3_s1('k')
 #   define c3__khan   c3_s4('k','h','a','n')
@@ -810,6 +811,7 @@
 #   define c3__nub    c3_s3('n','u','b')
 #   define c3__null   c3_s4('n','u','l','l')
 #   define c3__nz     c3_s2('n','z')
+#   define c3__o      c3_s1('o')
 #   define c3__oak    c3_s3('o','a','k')
 #   define c3__of     c3_s2('o','f')
 #   define c3__off    c3_s3('o','f','f')
@@ -972,6 +974,7 @@
 #   define c3__rsh    c3_s3('r','s','h')
 #   define c3__rulf   c3_s4('r','u','l','f')
 #   define c3__run    c3_s3('r','u','n')
+#   define c3__s      c3_s1('s')
 #   define c3__safe   c3_s4('s','a','f','e')
 #   define c3__sag    c3_s3('s','a','g')
 #   define c3__sail   c3_s4('s','a','i','l')
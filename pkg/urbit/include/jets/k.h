@@ -87,6 +87,11 @@
     u3_weak
     u3kdb_put(u3_noun a, u3_noun b, u3_noun c);
 
+  /* u3kdb_del(): map delete for key `b` in map `a`.
+  */
+    u3_noun
+    u3kdb_del(u3_noun a, u3_noun b);
+
   /* u3kdb_has(): test for get.
   */
     u3_noun
@@ -107,6 +112,11 @@
     u3_noun
     u3kdi_gas(u3_noun a, u3_noun b);
 
+  /* u3kdi_del(): delete from set.
+  */
+    u3_noun
+    u3kdi_del(u3_noun a, u3_noun b);
+
   /* u3kdi_has(): test for presence.
   */
     u3_noun
@@ -80,13 +80,16 @@
     u3_noun u3qdb_any(u3_noun, u3_noun);
     u3_noun u3qdb_apt(u3_noun);
     u3_noun u3qdb_bif(u3_noun, u3_noun);
+    u3_noun u3qdb_del(u3_noun, u3_noun);
     u3_noun u3qdb_dif(u3_noun, u3_noun);
+    u3_noun u3qdb_dig(u3_noun, u3_noun);
     u3_noun u3qdb_gas(u3_noun, u3_noun);
     u3_noun u3qdb_get(u3_noun, u3_noun);
     u3_noun u3qdb_has(u3_noun, u3_noun);
     u3_noun u3qdb_int(u3_noun, u3_noun);
     u3_noun u3qdb_key(u3_noun);
     u3_noun u3qdb_put(u3_noun, u3_noun, u3_noun);
+    u3_noun u3qdb_rib(u3_noun, u3_noun, u3_noun);
     u3_noun u3qdb_run(u3_noun, u3_noun);
 #   define u3qdb_tap u3qdi_tap
     u3_noun u3qdb_uni(u3_noun, u3_noun);
@@ -95,11 +98,17 @@
 
     u3_noun u3qdi_apt(u3_noun);
     u3_noun u3qdi_bif(u3_noun, u3_noun);
+    u3_noun u3qdi_del(u3_noun, u3_noun);
+    u3_noun u3qdi_del_own(u3_noun, u3_noun, c3_o);
     u3_noun u3qdi_dif(u3_noun, u3_noun);
+    u3_noun u3qdi_dig(u3_noun, u3_noun);
     u3_noun u3qdi_gas(u3_noun, u3_noun);
+    u3_weak u3qdi_gas_bulk(u3_noun, u3_noun, c3_o);
     u3_noun u3qdi_has(u3_noun, u3_noun);
     u3_noun u3qdi_int(u3_noun, u3_noun);
     u3_noun u3qdi_put(u3_noun, u3_noun);
+    u3_noun u3qdi_put_own(u3_noun, u3_noun, c3_o);
+    c3_o    u3qdi_own(u3_noun, u3a_cell**, u3a_cell**);
     u3_noun u3qdi_rep(u3_noun, u3_noun);
     u3_noun u3qdi_run(u3_noun, u3_noun);
     u3_noun u3qdi_tap(u3_noun);
@@ -119,6 +128,12 @@
     u3_noun u3qe_repg(u3_noun, u3_noun, u3_noun);
     u3_noun u3qe_rexp(u3_noun, u3_noun);
     u3_noun u3qe_trip(u3_atom);
+    u3_noun u3qe_cass(u3_noun);
+    u3_noun u3qe_cuss(u3_noun);
+    u3_noun u3qe_crip(u3_noun);
+    u3_noun u3qe_trim(u3_atom, u3_noun);
+    u3_noun u3qe_tuba(u3_noun);
+    u3_noun u3qe_tufa(u3_noun);
 
     u3_noun u3qea_ecba_en(u3_atom, u3_atom);
     u3_noun u3qea_ecba_de(u3_atom, u3_atom);
@@ -145,6 +160,11 @@
 
     u3_noun u3qe_en_base16(u3_atom len, u3_atom dat);
     u3_noun u3qe_de_base16(u3_atom inp);
+    u3_noun u3qe_en_base64(u3_atom pad, u3_atom url, u3_atom len, u3_atom dat);
+    u3_noun u3qe_de_base64(u3_atom pad, u3_atom url, u3_atom inp);
+
+    u3_noun u3qe_en_json(u3_noun val);
+    u3_noun u3qe_de_json(u3_atom txt);
 
     u3_noun u3qeo_raw(u3_atom, u3_atom);
 
@@ -85,6 +85,7 @@
     u3_noun u3wdb_bif(u3_noun);
     u3_noun u3wdb_del(u3_noun);
     u3_noun u3wdb_dif(u3_noun);
+    u3_noun u3wdb_dig(u3_noun);
     u3_noun u3wdb_gas(u3_noun);
     u3_noun u3wdb_get(u3_noun);
     u3_noun u3wdb_has(u3_noun);
@@ -96,6 +97,7 @@
     u3_noun u3wdb_uni(u3_noun);
     u3_noun u3wdb_urn(u3_noun);
 #   define u3wdb_rep u3wdi_rep
+    u3_noun u3wdb_rib(u3_noun);
     u3_noun u3wdb_run(u3_noun);
 #   define u3wdb_wyt u3wdi_wyt
 
@@ -103,6 +105,7 @@
     u3_noun u3wdi_bif(u3_noun);
     u3_noun u3wdi_del(u3_noun);
     u3_noun u3wdi_dif(u3_noun);
+    u3_noun u3wdi_dig(u3_noun);
     u3_noun u3wdi_gas(u3_noun);
     u3_noun u3wdi_has(u3_noun);
     u3_noun u3wdi_int(u3_noun);
@@ -129,6 +132,12 @@
     u3_noun u3we_repg(u3_noun);
     u3_noun u3we_rexp(u3_noun);
     u3_noun u3we_trip(u3_noun);
+    u3_noun u3we_cass(u3_noun);
+    u3_noun u3we_cuss(u3_noun);
+    u3_noun u3we_crip(u3_noun);
+    u3_noun u3we_trim(u3_noun);
+    u3_noun u3we_tuba(u3_noun);
+    u3_noun u3we_tufa(u3_noun);
 
     u3_noun u3we_scow(u3_noun);
     u3_noun u3we_scot(u3_noun);
@@ -211,6 +220,11 @@
 
     u3_noun u3we_en_base16(u3_noun);
     u3_noun u3we_de_base16(u3_noun);
+    u3_noun u3we_en_base64(u3_noun);
+    u3_noun u3we_de_base64(u3_noun);
+
+    u3_noun u3we_en_json(u3_noun);
+    u3_noun u3we_de_json(u3_noun);
 
     u3_noun u3we_bend_fun(u3_noun);
     u3_noun u3we_cold_fun(u3_noun);
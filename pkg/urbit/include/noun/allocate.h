@@ -119,7 +119,11 @@
         u3p(c3_w) rut_p;                      //  bottom of durable region
         u3p(c3_w) ear_p;                      //  original cap if kid is live
 
-        c3_w fut_w[32];                       //  futureproof buffer
+        struct {                              //  kept %memo results
+          u3p(u3h_root) har_p;                //  (map [bus key] [cos sco pro])
+        } mem;                                //  (see u3n_memo_reap())
+
+        c3_w fut_w[31];                       //  futureproof buffer
 
         struct {                              //  escape buffer
           union {
@@ -609,6 +613,11 @@
           c3_o
           u3a_rewrite_ptr(void* ptr_v);
 
+        /* u3a_rewrite_mptr(): mark a u3a_malloc() pointer as rewritten.
+        */
+          c3_o
+          u3a_rewrite_mptr(void* ptr_v);
+
         /* u3a_rewrite_noun(): rewrite a noun for compaction.
         */
           void
@@ -624,6 +633,11 @@
           u3_noun
           u3a_rewritten_noun(u3_noun som);
 
+        /* u3a_rewritten_mptr(): rewrite a u3a_malloc() pointer for compaction.
+        */
+          u3_post
+          u3a_rewritten_mptr(u3_post ptr_p);
+
         /* u3a_count_noun(): count size of noun.
         */
           c3_w
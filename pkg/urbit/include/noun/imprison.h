@@ -54,6 +54,17 @@
           u3_atom
           u3i_slab_moot(u3i_slab* sab_u);
 
+        /* u3i_slab_limbs(): configure slab for [len_d] GMP limbs,
+        **                   uninitialized; produce where to write them.
+        */
+          mp_limb_t*
+          u3i_slab_limbs(u3i_slab* sab_u, c3_d len_d);
+
+        /* u3i_slab_mint_limbs(): produce atom from limb-slab, trimming.
+        */
+          u3_atom
+          u3i_slab_mint_limbs(u3i_slab* sab_u);
+
         /* u3i_slab_mint_bytes(): produce atom from byte-slab, trimming.
         ** XX assumes little-endian, implement swap to support big-endian
         */
@@ -47,6 +47,10 @@
         c3_o              liv;                 //  live (enabled)
         c3_l              axe_l;               //  computed/discovered axis
         struct _u3j_core* cop_u;               //  containing core
+        c3_d              cal_d;               //  calls
+        c3_d              tim_d;               //  time in jet (ns, -P)
+        c3_d              pun_d;               //  punts back to nock
+        c3_d              mis_d;               //  test-mode mismatches
       } u3j_harm;
 
     /* u3j_hood: hook description.
@@ -78,6 +82,7 @@
         c3_l          len_l;            //  dynamic array length
         c3_l          all_l;            //  allocated length
         u3j_core*     ray_u;            //  dynamic array by axis
+        c3_w          epo_w;            //  cold state epoch
       } u3j_dash;
 
     /* u3j_fist: a single step in a fine check.
@@ -103,21 +108,35 @@
         u3p(u3j_fink) fin_p;          //  fine check
       } u3j_rite;
 
-    /* u3j_site: site of a kick (nock 9), used to cache call target.
+    /* u3j_line: one cached call target at a u3j_site.
     */
       struct _u3n_prog;
       typedef struct {
-        u3p(struct _u3n_prog) pog_p;  //  program for formula
-        u3_noun       axe;            //  axis
-        u3_weak       bat;            //  battery (for verification)
+        u3p(struct _u3n_prog) pog_p;  //  program for formula, or 0
+        u3_weak       bat;            //  battery (u3_none if empty)
         u3_weak       bas;            //  hash of battery (for hot find)
         u3_weak       loc;            //  location (for reaming)
         c3_o          jet_o;          //  have jet driver?
-        c3_o          fon_o;          //  site owns fink?
+        c3_o          fon_o;          //  line owns fink?
         u3_weak       lab;            //  label (for tracing)
         u3j_core*     cop_u;          //  jet core
         u3j_harm*     ham_u;          //  jet arm
         u3p(u3j_fink) fin_p;          //  fine check
+        c3_w          epo_w;          //  cold epoch, if unlocated
+      } u3j_line;
+
+    /* u3j_site: site of a kick (nock 9), used to cache call targets.
+    **
+    **   A site is a small polymorphic inline cache: up to
+    **   u3j_site_ways lines, filled front to back, newest first.
+    */
+#     define u3j_site_ways 4
+      typedef struct {
+        u3p(struct _u3n_prog) pog_p;  //  program of last unjetted kick
+        u3_noun       axe;            //  axis (formula, if direct)
+        c3_w          hit_w;          //  kicks served by a line
+        c3_w          mis_w;          //  kicks that spotted the core
+        u3j_line      lin_u[u3j_site_ways];  //  lines
       } u3j_site;
 
   /** Globals.
@@ -236,6 +255,11 @@
         void
         u3j_site_merge(u3j_site* dst_u, u3j_site* src_u);
 
+      /* u3j_site_init(): initialize an empty u3j_site. axe is TRANSFERRED.
+      */
+        void
+        u3j_site_init(u3j_site* sit_u, u3_noun axe);
+
       /* u3j_site_ream(): refresh u3j_site after restoring from checkpoint
       */
         void
@@ -281,6 +305,30 @@
         c3_w
         u3j_site_mark(u3j_site* sit_u);
 
+      /* u3j_rite_rewrite(): rewrite u3j_rite for compaction.
+      */
+        void
+        u3j_rite_rewrite(u3j_rite* rit_u);
+
+      /* u3j_site_rewrite(): rewrite u3j_site for compaction.
+      */
+        void
+        u3j_site_rewrite(u3j_site* sit_u);
+
+      /* u3j_prof(): jet arm metrics since boot, as a $mass.
+      **
+      **   [%jets %| (list [lab=@t %| (list [@t %& @ud])])], with calls,
+      **   time in the jet (ns, only when profiling), punts back to nock
+      **   and test-mode mismatches, for each arm that has been called.
+      */
+        u3_noun
+        u3j_prof(void);
+
+      /* u3j_damp(): print the busiest jet arms.
+      */
+        void
+        u3j_damp(FILE* fil_u);
+
       /* u3j_mark(): mark jet state for gc.
       */
         c3_w
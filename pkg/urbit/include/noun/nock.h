@@ -12,14 +12,27 @@
     u3_noun key;
   } u3n_memo;
 
+  /* u3n_slot: one direct-threaded instruction (see _n_thread())
+   */
+  typedef struct {
+    c3_w    lab_w;                    // handler offset << 8 | opcode
+    c3_w    arg_w;                    // decoded operand
+  } u3n_slot;
+
   /* u3n_prog: program compiled from nock
    */
   typedef struct _u3n_prog {
     struct {
       c3_o      own_o;                // program owns ops_y?
       c3_w      len_w;                // length of bytecode (bytes)
+      c3_w      hig_w;                // stack height bound (words)
       c3_y*     ops_y;                // actual array of bytes
     } byc_u;                          // bytecode
+    struct {
+      c3_o      liv_o;                // built by this process?
+      c3_w      len_w;                // number of slots
+      u3n_slot* ops_u;                // array of slots
+    } thr_u;                          // direct-threaded form
     struct {
       c3_w      len_w;                // number of literals
       u3_noun*  non;                  // array of literals
@@ -36,6 +49,7 @@
       c3_w      len_w;                // number of registration sites
       u3j_rite* rit_u;                // array of sites
     } reg_u;                          // registration site data
+    c3_l        mug_l;                // formula mug (for profiling)
   } u3n_prog;
 
   /**  Functions.
@@ -111,11 +125,46 @@
       u3p(u3h_root)
       u3n_take(u3p(u3h_root) har_p);
 
+    /* u3n_memo_reap(): promote kept %memo results, summing scores.
+     */
+      void
+      u3n_memo_reap(u3p(u3h_root) har_p);
+
+    /* u3n_memo_take(): copy junior kept %memo results.
+     */
+      u3p(u3h_root)
+      u3n_memo_take(u3p(u3h_root) har_p);
+
     /* u3n_mark(): mark bytecode cache.
      */
       c3_w
       u3n_mark(FILE* fil_u);
 
+    /* u3n_damp(): print and clear the bytecode pair census,
+    **             the kick site counters, refcount elisions,
+    **             %memo counters, and the bytecode profile.
+    */
+      void
+      u3n_damp(FILE* fil_u);
+
+    /* u3n_prof(): bytecode profile since the last call, ranked, and reset.
+    **
+    **   only collected when profiling (-P); produces
+    **   [ops=(list [@tas @ud]) pog=(list [@ux (unit [path @ud]) @ud @ud @ud])
+    **    unj=(list [[path @ud] @ud @ud])]:
+    **   opcode counts; formula mug, arm label, entries, opcodes, and
+    **   exclusive burn time (ns) of the hottest programs; and label,
+    **   entries and burn time of the hottest arms of registered cores
+    **   that were kicked without a jet driver.
+    */
+      u3_noun
+      u3n_prof(void);
+
+    /* u3n_prof_unwind(): stop charging the program a bail unwound.
+    */
+      void
+      u3n_prof_unwind(void);
+
     /* u3n_reclaim(): clear ad-hoc persistent caches to reclaim memory.
     */
       void
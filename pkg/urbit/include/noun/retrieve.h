@@ -1,6 +1,16 @@
 #ifndef U3_RETRIEVE_H
 #define U3_RETRIEVE_H
 
+  /**  Structures.
+  **/
+    /* u3r_mpv: read-only GMP view of an atom.
+    */
+      typedef struct _u3r_mpv {
+        mpz_t       mp;                       //  the view
+        mp_limb_t   sat;                      //  direct atom storage
+        mp_limb_t*  buf;                      //  copied limbs (nullable)
+      } u3r_mpv;
+
     /** u3r_*: read without ever crashing.
     **/
 #if 1
@@ -384,6 +394,21 @@
         u3r_mp(mpz_t   a_mp,
                u3_atom b);
 
+      /* u3r_mp_view():
+      **
+      **   Point (mpv_u) at (b), read-only, without copying if possible.
+      */
+        void
+        u3r_mp_view(u3r_mpv* mpv_u,
+                    u3_atom  b);
+
+      /* u3r_mp_done():
+      **
+      **   Release the view (mpv_u).
+      */
+        void
+        u3r_mp_done(u3r_mpv* mpv_u);
+
       /* u3r_short():
       **
       **   Return short (a_w) of (b).
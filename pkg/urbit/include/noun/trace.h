@@ -47,6 +47,13 @@
       void
       u3t_push(u3_noun mon);
 
+    /* u3t_lend(): push on trace stack, without retaining [mon].
+    **
+    **   [mon] must outlive the frame (eg, a bytecode literal).
+    */
+      void
+      u3t_lend(u3_noun mon);
+
     /* u3t_mean(): push `[%mean roc]` on trace stack.
     */
       void
@@ -57,6 +64,14 @@
       void
       u3t_drop(void);
 
+    /* u3t_flush(): materialize the current road's trace into bug.tax.
+    **
+    **   pushes are recorded lazily, off-loom; call this before
+    **   reading u3R->bug.tax directly.
+    */
+      void
+      u3t_flush(void);
+
     /* u3t_slog(): print directly.
     */
       void
@@ -15,6 +15,7 @@
         c3_o    rec_o;             //  reclaim cache
         c3_o    mut_o;             //  mutated kerne
         u3_noun sac;               //  space measurementl
+        c3_d    pro_d;             //  last profile save (s)
         void  (*xit_f)(void);      //  exit callback
       } u3_serf;
 
@@ -291,6 +291,7 @@
         c3_c*   key_c;                      //  -k, private key file
         c3_o    net;                        //  -L, local-only networking
         c3_o    lit;                        //  -l, lite mode
+        c3_o    mem;                        //      keep %memo results
         c3_c*   til_c;                      //  -n, play till eve_d
         c3_o    pro;                        //  -P, profile
         c3_s    per_s;                      //      http port
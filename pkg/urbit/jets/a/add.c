@@ -10,6 +10,8 @@
   u3qa_add(u3_atom a,
            u3_atom b)
   {
+    c3_d a_d, b_d;
+
     if ( _(u3a_is_cat(a)) && _(u3a_is_cat(b)) ) {
       c3_w c = a + b;
 
@@ -18,6 +20,12 @@
     else if ( 0 == a ) {
       return u3k(b);
     }
+    else if ( _(u3r_safe_chub(a, &a_d)) && _(u3r_safe_chub(b, &b_d)) ) {
+      c3_d c_d[2] = { a_d + b_d, 0 };
+
+      c_d[1] = ( c_d[0] < a_d ) ? 1 : 0;
+      return u3i_chubs(2, c_d);
+    }
     else {
       mpz_t a_mp, b_mp;
 
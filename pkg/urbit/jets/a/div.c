@@ -10,6 +10,8 @@
   u3qa_div(u3_atom a,
            u3_atom b)
   {
+    c3_d a_d, b_d;
+
     if ( 0 == b ) {
       return u3m_error("divide-by-zero");
     }
@@ -17,16 +19,37 @@
       if ( _(u3a_is_cat(a)) && _(u3a_is_cat(b)) ) {
         return a / b;
       }
+      else if ( _(u3r_safe_chub(a, &a_d)) && _(u3r_safe_chub(b, &b_d)) ) {
+        return u3i_chub(a_d / b_d);
+      }
       else {
-        mpz_t a_mp, b_mp;
+        u3r_mpv    a_u, b_u;
+        u3i_slab   sab_u;
+        mp_limb_t* quo;
+        mp_limb_t* rem;
+        mp_size_t  a_n, b_n;
+
+        u3r_mp_view(&a_u, a);
+        u3r_mp_view(&b_u, b);
+        a_n = mpz_size(a_u.mp);
+        b_n = mpz_size(b_u.mp);
+
+        if ( a_n < b_n ) {
+          u3r_mp_done(&a_u);
+          u3r_mp_done(&b_u);
+          return 0;
+        }
 
-        u3r_mp(a_mp, a);
-        u3r_mp(b_mp, b);
+        quo = u3i_slab_limbs(&sab_u, (a_n - b_n) + 1);
+        rem = u3a_malloc(b_n * sizeof(mp_limb_t));
 
-        mpz_tdiv_q(a_mp, a_mp, b_mp);
-        mpz_clear(b_mp);
+        mpn_tdiv_qr(quo, rem, 0, mpz_limbs_read(a_u.mp), a_n,
+                                 mpz_limbs_read(b_u.mp), b_n);
 
-        return u3i_mp(a_mp);
+        u3a_free(rem);
+        u3r_mp_done(&a_u);
+        u3r_mp_done(&b_u);
+        return u3i_slab_mint_limbs(&sab_u);
       }
     }
   }
@@ -22,6 +22,9 @@ u3qa_gth(u3_atom a, u3_atom b)
     if ( a_w != b_w ) {
       return __(a_w > b_w);
     }
+    else if ( 64 >= a_w ) {
+      return __(u3r_chub(0, a) > u3r_chub(0, b));
+    }
     else {
       mpz_t   a_mp, b_mp;
       u3_noun cmp;
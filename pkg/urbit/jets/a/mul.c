@@ -6,10 +6,27 @@
 
 /* functions
 */
+  //  full 128-bit product of two chubs, low chub first
+  //
+  static void
+  _mul_chub(c3_d a_d, c3_d b_d, c3_d* c_d)
+  {
+    c3_d lo_d = (a_d & 0xffffffffULL) * (b_d & 0xffffffffULL);
+    c3_d hl_d = (a_d >> 32)           * (b_d & 0xffffffffULL);
+    c3_d lh_d = (a_d & 0xffffffffULL) * (b_d >> 32);
+    c3_d hh_d = (a_d >> 32)           * (b_d >> 32);
+    c3_d mid_d = (lo_d >> 32) + (hl_d & 0xffffffffULL) + lh_d;
+
+    c_d[0] = (mid_d << 32) | (lo_d & 0xffffffffULL);
+    c_d[1] = hh_d + (hl_d >> 32) + (mid_d >> 32);
+  }
+
   u3_noun
   u3qa_mul(u3_atom a,
            u3_atom b)
   {
+    c3_d a_d, b_d;
+
     if ( _(u3a_is_cat(a)) && _(u3a_is_cat(b)) ) {
       c3_d c = ((c3_d) a) * ((c3_d) b);
 
@@ -18,16 +35,42 @@
     else if ( 0 == a ) {
       return 0;
     }
+    else if ( _(u3r_safe_chub(a, &a_d)) && _(u3r_safe_chub(b, &b_d)) ) {
+      c3_d c_d[2];
+
+      _mul_chub(a_d, b_d, c_d);
+      return u3i_chubs(2, c_d);
+    }
     else {
-      mpz_t a_mp, b_mp;
+      u3r_mpv    a_u, b_u;
+      u3i_slab   sab_u;
+      mp_limb_t* pro;
+      mp_size_t  a_n, b_n;
+
+      u3r_mp_view(&a_u, a);
+      u3r_mp_view(&b_u, b);
+      a_n = mpz_size(a_u.mp);
+      b_n = mpz_size(b_u.mp);
+
+      if ( 0 == b_n ) {
+        u3r_mp_done(&a_u);
+        return 0;
+      }
 
-      u3r_mp(a_mp, a);
-      u3r_mp(b_mp, b);
+      pro = u3i_slab_limbs(&sab_u, a_n + b_n);
 
-      mpz_mul(a_mp, a_mp, b_mp);
-      mpz_clear(b_mp);
+      if ( a_n >= b_n ) {
+        mpn_mul(pro, mpz_limbs_read(a_u.mp), a_n,
+                     mpz_limbs_read(b_u.mp), b_n);
+      }
+      else {
+        mpn_mul(pro, mpz_limbs_read(b_u.mp), b_n,
+                     mpz_limbs_read(a_u.mp), a_n);
+      }
 
-      return u3i_mp(a_mp);
+      u3r_mp_done(&a_u);
+      u3r_mp_done(&b_u);
+      return u3i_slab_mint_limbs(&sab_u);
     }
   }
   u3_noun
@@ -10,6 +10,8 @@
   u3qa_sub(u3_atom a,
            u3_atom b)
   {
+    c3_d a_d, b_d;
+
     if ( _(u3a_is_cat(a)) && _(u3a_is_cat(b)) ) {
       if ( a < b ) {
         return u3m_error("subtract-underflow");
@@ -19,6 +21,12 @@
     else if ( 0 == b ) {
       return u3k(a);
     }
+    else if ( _(u3r_safe_chub(a, &a_d)) && _(u3r_safe_chub(b, &b_d)) ) {
+      if ( a_d < b_d ) {
+        return u3m_error("subtract-underflow");
+      }
+      else return u3i_chub(a_d - b_d);
+    }
     else {
       mpz_t a_mp, b_mp;
 
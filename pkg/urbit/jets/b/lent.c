@@ -12,6 +12,9 @@ u3qb_lent(u3_noun a)
   c3_w len_w = 0;
 
   while ( u3_nul != a ) {
+    if ( c3n == u3du(a) ) {
+      return u3m_bail(c3__exit);
+    }
     a = u3t(a);
     len_w++;
   }
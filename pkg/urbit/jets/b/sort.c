@@ -6,72 +6,144 @@
 
 /* functions
 */
-  // like skid, except its callback is $-([* *] ?) and it takes the second
-  // argument so that it calls its callback with [i.list, second]
+  //  +sort is a quicksort on the head of each sublist: the elements
+  //  the gate puts before the head (in order), the head, and then the
+  //  rest (in order), each side sorted the same way. the partitions
+  //  below are exactly those, so ties and inconsistent gates order
+  //  as they do in the hoon.
   //
-  // all args are RETAINED
-  static u3_noun
-  _split_in(u3j_site* sit_u,
-            u3_noun a,
-            u3_noun second)
+  //  the gate is also slammed in the arm's order: +skid tests each
+  //  sublist from its last element back to its first, and the left
+  //  side is sorted before the right. so crashes, traces and ~&
+  //  output come out as they would from the hoon.
+  //
+  //  the list is sorted as an array, with an explicit stack of ranges,
+  //  so nothing is consed until the product.
+
+  //  stable-partition buf[lo_w + 1, hi_w) about buf[lo_w], back to
+  //  front, using tmp; produces the final index of the pivot
+  //
+  static c3_w
+  _sort_part(u3j_site* sit_u,
+             u3_noun*  buf,
+             u3_noun*  tmp,
+             c3_w      lo_w,
+             c3_w      hi_w)
   {
-    if ( 0 == a ) {
-      return u3nc(u3_nul, u3_nul);
-    }
-    else if ( c3n == u3du(a) ) {
-      return u3m_bail(c3__exit);
-    } else {
-      u3_noun acc = _split_in(sit_u, u3t(a), second);
-      u3_noun hoz = u3j_gate_slam(sit_u, u3nc(u3k(u3h(a)), u3k(second)));
-      u3_noun nex;
+    u3_noun piv   = buf[lo_w];
+    c3_w    lef_w = 0,
+            rig_w = hi_w,
+            i_w;
 
-      if ( c3y == hoz ) {
-        nex = u3nc(u3nc(u3k(u3h(a)), u3k(u3h(acc))), u3k(u3t(acc)));
-      }
-      else {
-        nex = u3nc(u3k(u3h(acc)), u3nc(u3k(u3h(a)), u3k(u3t(acc))));
+    //  the right side fills buf from the top down, never past i_w;
+    //  the left side collects in tmp, reversed
+    //
+    for ( i_w = hi_w; --i_w > lo_w; ) {
+      u3_noun i = buf[i_w];
+
+      switch ( u3j_gate_slam(sit_u, u3nc(u3k(i), u3k(piv))) ) {
+        case c3y: {
+          tmp[lef_w++] = i;
+        } break;
+
+        case c3n: {
+          buf[--rig_w] = i;
+        } break;
+
+        default: u3m_bail(c3__exit);
       }
-      u3z(hoz);
-      u3z(acc);
+    }
 
-      return nex;
+    for ( i_w = 0; i_w < lef_w; i_w++ ) {
+      buf[lo_w + i_w] = tmp[lef_w - (i_w + 1)];
     }
+    buf[lo_w + lef_w] = piv;
+
+    return lo_w + lef_w;
   }
 
-  static u3_noun
-  _sort_in(u3j_site* sit_u, u3_noun list)
+  //  sort buf[0, len_w) in place
+  //
+  static void
+  _sort_in(u3j_site* sit_u, u3_noun* buf, c3_w len_w)
   {
-    if ( 0 == list ) {
-      return u3_nul;
-    }
-    else if ( c3n == u3du(list) ) {
-      return u3m_bail(c3__exit);
-    } else {
-      u3_noun hed, tal;
-      u3x_cell(list, &hed, &tal);
+    u3_noun* tmp = u3a_malloc(len_w * sizeof(u3_noun));
+    //  right sides still to sort, after the left side of each; they
+    //  are disjoint and at least two long, so len_w / 2 of them fit
+    //
+    c3_w   (*ran_w)[2] = u3a_malloc((1 + (len_w / 2)) * sizeof(*ran_w));
+    c3_w     top_w = 0;
+
+    ran_w[top_w][0] = 0;
+    ran_w[top_w][1] = len_w;
+    top_w++;
 
-      u3_noun split = _split_in(sit_u, tal, hed);
-      u3_noun lhs = _sort_in(sit_u, u3h(split));
-      u3_noun rhs = u3nc(u3k(hed), _sort_in(sit_u, u3t(split)));
+    while ( top_w ) {
+      c3_w lo_w, hi_w;
 
-      u3_noun ret = u3qb_weld(lhs, rhs);
-      u3z(lhs);
-      u3z(rhs);
-      u3z(split);
+      top_w--;
+      lo_w = ran_w[top_w][0];
+      hi_w = ran_w[top_w][1];
 
-      return ret;
+      while ( (hi_w - lo_w) > 1 ) {
+        c3_w piv_w = _sort_part(sit_u, buf, tmp, lo_w, hi_w);
+
+        if ( (hi_w - (piv_w + 1)) > 1 ) {
+          ran_w[top_w][0] = piv_w + 1;
+          ran_w[top_w][1] = hi_w;
+          top_w++;
+        }
+        hi_w = piv_w;
+      }
     }
+
+    u3a_free(ran_w);
+    u3a_free(tmp);
   }
 
   u3_noun
   u3qb_sort(u3_noun a,
             u3_noun b)
   {
-    u3_noun  pro;
+    u3_noun  pro, t = a;
+    u3_noun* buf;
+    u3_noun* hed;
+    u3_noun* tel;
+    u3_noun* lit = &pro;
+    c3_w     len_w = 0,
+             i_w;
     u3j_site sit_u;
+
+    if ( u3_nul == a ) {
+      return u3_nul;
+    }
+
+    while ( u3_nul != t ) {
+      if ( c3n == u3du(t) ) {
+        return u3m_bail(c3__exit);
+      }
+      t = u3t(t);
+      len_w++;
+    }
+
+    buf = u3a_malloc(len_w * sizeof(u3_noun));
+
+    for ( t = a, i_w = 0; i_w < len_w; i_w++, t = u3t(t) ) {
+      buf[i_w] = u3h(t);
+    }
+
     u3j_gate_prep(&sit_u, u3k(b));
-    pro = _sort_in(&sit_u, a);
+    _sort_in(&sit_u, buf, len_w);
     u3j_gate_lose(&sit_u);
+
+    for ( i_w = 0; i_w < len_w; i_w++ ) {
+      *lit = u3i_defcons(&hed, &tel);
+      *hed = u3k(buf[i_w]);
+      lit  = tel;
+    }
+    *lit = u3_nul;
+
+    u3a_free(buf);
     return pro;
   }
   u3_noun
@@ -85,4 +157,3 @@
       return u3qb_sort(a, b);
     }
   }
-
@@ -6,16 +6,16 @@
 u3_noun
 u3qc_bex(u3_atom a)
 {
-  mpz_t a_mp;
-
   if ( !_(u3a_is_cat(a)) ) {
     return u3m_bail(c3__fail);
   }
   else {
-    mpz_init_set_ui(a_mp, 1);
-    mpz_mul_2exp(a_mp, a_mp, a);
+    u3i_slab sab_u;
+
+    u3i_slab_init(&sab_u, 0, (c3_d)a + 1);
+    sab_u.buf_w[a >> 5] = (c3_w)1 << (a & 31);
 
-    return u3i_mp(a_mp);
+    return u3i_slab_moot(&sab_u);
   }
 }
 
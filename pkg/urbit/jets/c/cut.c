@@ -27,6 +27,7 @@
       c3_w b_w   = b;
       c3_w c_w   = c;
       c3_w len_w = u3r_met(a_g, d);
+      c3_d d_d;
 
       if ( (0 == c_w) || (b_w >= len_w) ) {
         return 0;
@@ -37,6 +38,14 @@
       if ( (b_w == 0) && (c_w == len_w) ) {
         return u3k(d);
       }
+      else if ( _(u3r_safe_chub(d, &d_d)) ) {
+        c3_d wid_d = (c3_d)c_w << a_g;
+
+        d_d >>= ((c3_d)b_w << a_g);
+
+        return u3i_chub(( wid_d >= 64 ) ? d_d
+                                        : (d_d & ((1ULL << wid_d) - 1)));
+      }
       else {
         u3i_slab sab_u;
         u3i_slab_init(&sab_u, a_g, c_w);
@@ -18,6 +18,7 @@ u3qc_end(u3_atom a,
     c3_g a_g   = a;
     c3_w b_w   = b;
     c3_w len_w = u3r_met(a_g, c);
+    c3_d c_d;
 
     if ( 0 == b_w ) {
       return 0;
@@ -25,6 +26,11 @@ u3qc_end(u3_atom a,
     else if ( b_w >= len_w ) {
       return u3k(c);
     }
+    //  b_w < len_w, so the mask is inside the chub
+    //
+    else if ( _(u3r_safe_chub(c, &c_d)) ) {
+      return u3i_chub(c_d & ((1ULL << ((c3_d)b_w << a_g)) - 1));
+    }
     else {
       u3i_slab sab_u;
       u3i_slab_init(&sab_u, a_g, b_w);
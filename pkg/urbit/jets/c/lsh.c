@@ -18,10 +18,16 @@ u3qc_lsh(u3_atom a,
     c3_g a_g   = a;
     c3_w b_w   = b;
     c3_w len_w = u3r_met(a_g, c);
+    c3_d c_d;
 
     if ( 0 == len_w ) {
       return 0;
     }
+    else if (  _(u3r_safe_chub(c, &c_d))
+            && ((c3_bits_dword(c_d) + ((c3_d)b_w << a_g)) <= 64) )
+    {
+      return u3i_chub(c_d << ((c3_d)b_w << a_g));
+    }
     else if ( (b_w + len_w) < len_w ) {
       return u3m_bail(c3__exit);
     }
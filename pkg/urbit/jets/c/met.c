@@ -10,12 +10,19 @@
   u3qc_met(u3_atom a,
            u3_atom b)
   {
+    c3_d b_d;
+
     if ( 0 == b ) {
       return 0;
     }
     else if ( !_(u3a_is_cat(a)) || (a >= 32) ) {
       return 1;
     }
+    else if ( _(u3r_safe_chub(b, &b_d)) ) {
+      c3_d bit_d = c3_bits_dword(b_d);
+
+      return (c3_w)((bit_d + ((1ULL << a) - 1)) >> a);
+    }
     else {
       c3_w met_w = u3r_met(a, b);
 
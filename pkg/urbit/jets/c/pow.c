@@ -14,12 +14,15 @@
       return u3m_bail(c3__fail);
     }
     else {
-      mpz_t a_mp;
+      u3r_mpv a_u;
+      mpz_t   b_mp;
 
-      u3r_mp(a_mp, a);
-      mpz_pow_ui(a_mp, a_mp, b);
+      u3r_mp_view(&a_u, a);
+      mpz_init(b_mp);
+      mpz_pow_ui(b_mp, a_u.mp, b);
+      u3r_mp_done(&a_u);
 
-      return u3i_mp(a_mp);
+      return u3i_mp(b_mp);
     }
   }
   u3_noun
@@ -18,10 +18,16 @@ u3qc_rsh(u3_atom a,
     c3_g a_g   = a;
     c3_w b_w   = b;
     c3_w len_w = u3r_met(a_g, c);
+    c3_d c_d;
 
     if ( b_w >= len_w ) {
       return 0;
     }
+    //  b_w < len_w, so the shift is inside the chub
+    //
+    else if ( _(u3r_safe_chub(c, &c_d)) ) {
+      return u3i_chub(c_d >> ((c3_d)b_w << a_g));
+    }
     else {
       u3i_slab sab_u;
       u3i_slab_init(&sab_u, a_g, (len_w - b_w));
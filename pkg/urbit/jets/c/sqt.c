@@ -9,13 +9,31 @@
   u3_noun
   u3qc_sqt(u3_atom a)
   {
-    mpz_t a_mp, b_mp;
+    u3r_mpv    a_u;
+    u3i_slab   sqt_u, rem_u;
+    mp_limb_t* sqt;
+    mp_limb_t* rem;
+    mp_size_t  a_n, r_n;
 
-    u3r_mp(a_mp, a);
-    mpz_init(b_mp);
-    mpz_sqrtrem(a_mp, b_mp, a_mp);
+    if ( 0 == a ) {
+      return u3nc(0, 0);
+    }
+
+    u3r_mp_view(&a_u, a);
+    a_n = mpz_size(a_u.mp);
+
+    sqt = u3i_slab_limbs(&sqt_u, (a_n + 1) / 2);
+    rem = u3i_slab_limbs(&rem_u, a_n);
+
+    r_n = mpn_sqrtrem(sqt, rem, mpz_limbs_read(a_u.mp), a_n);
+
+    //  only the limbs of the remainder are written
+    //
+    memset(rem + r_n, 0, (a_n - r_n) * sizeof(mp_limb_t));
 
-    return u3nc(u3i_mp(a_mp), u3i_mp(b_mp));
+    u3r_mp_done(&a_u);
+    return u3nc(u3i_slab_mint_limbs(&sqt_u),
+                u3i_slab_mint_limbs(&rem_u));
   }
   u3_noun
   u3wc_sqt(u3_noun cor)
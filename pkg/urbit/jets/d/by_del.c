@@ -91,3 +91,12 @@ u3wdb_del(u3_noun cor)
   u3x_mean(cor, u3x_sam, &b, u3x_con_sam, &a, 0);
   return u3qdb_del(a, b);
 }
+
+u3_noun
+u3kdb_del(u3_noun a,
+          u3_noun b)
+{
+  u3_noun pro = u3qdi_del_own(a, b, c3y);
+  u3z(b);
+  return pro;
+}
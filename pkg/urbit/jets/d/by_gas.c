@@ -9,20 +9,20 @@ u3_noun
 u3qdb_gas(u3_noun a,
           u3_noun b)
 {
-  if ( u3_nul == b ) {
-    return u3k(a);
-  }
-  else {
-    u3_noun i_b,  t_b,
-            pi_b, qi_b;
-    u3x_cell(b, &i_b, &t_b);
-    u3x_cell(i_b, &pi_b, &qi_b);
+  u3_weak pro = u3qdi_gas_bulk(a, b, c3y);
+
+  if ( u3_none == pro ) {
+    u3_noun i_b;
 
-    u3_noun c = u3qdb_put(a, pi_b, qi_b);
-    u3_noun d = u3qdb_gas(c, t_b);
-    u3z(c);
-    return d;
+    pro = u3k(a);
+
+    while ( u3_nul != b ) {
+      u3x_cell(b, &i_b, &b);
+      pro = u3qdi_put_own(pro, i_b, c3y);
+    }
   }
+
+  return pro;
 }
 
 u3_noun
@@ -15,12 +15,7 @@ _by_key(u3_noun a, u3_noun set)
     u3_noun n_a, l_a, r_a;
     u3x_trel(a, &n_a, &l_a, &r_a);
 
-    {
-      u3_noun new = u3qdi_put(set, u3h(n_a));
-      u3z(set);
-      set = new;
-    }
-
+    set = u3kdi_put(set, u3k(u3h(n_a)));
     set = _by_key(l_a, set);
 
     return _by_key(r_a, set);
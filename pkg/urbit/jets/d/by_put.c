@@ -95,7 +95,8 @@ u3kdb_put(u3_noun a,
           u3_noun b,
           u3_noun c)
 {
-  u3_noun pro = u3qdb_put(a, b, c);
-  u3z(a); u3z(b); u3z(c);
+  u3_noun nod = u3nc(b, c);
+  u3_noun pro = u3qdi_put_own(a, nod, c3y);
+  u3z(nod);
   return pro;
 }
@@ -0,0 +1,95 @@
+/* j/4/by_rib.c
+**
+*/
+#include "all.h"
+
+/* _rib_frame: a node being transformed.
+*/
+typedef struct {
+  u3_noun a;                          //  node, RETAINED
+  u3_noun n;                          //  transformed n.a
+  u3_noun l;                          //  transformed l.a
+  c3_y    sat_y;                      //  0: unvisited, 1: in l.a, 2: in r.a
+} _rib_frame;
+
+//  preorder, threading the product of [c] from node to node;
+//  each subtree is rebuilt once both of its children are done
+//
+u3_noun
+u3qdb_rib(u3_noun a, u3_noun b, u3_noun c)
+{
+  u3_noun     acc = u3k(b);
+  u3_noun     pro = u3_nul;
+  u3a_pile    pil_u;
+  u3j_site    sit_u;
+  _rib_frame* fam_u;
+
+  if ( u3_nul == a ) {
+    return u3nc(acc, u3_nul);
+  }
+
+  u3a_pile_prep(&pil_u, sizeof(_rib_frame));
+  fam_u = u3a_push(&pil_u);
+  fam_u->a     = a;
+  fam_u->sat_y = 0;
+
+  u3j_gate_prep(&sit_u, u3k(c));
+
+  while ( c3n == u3a_pile_done(&pil_u) ) {
+    u3_noun n_a, l_a, r_a;
+    u3x_trel(fam_u->a, &n_a, &l_a, &r_a);
+
+    switch ( fam_u->sat_y ) {
+      case 0: {
+        u3_noun d = u3j_gate_slam(&sit_u, u3nc(u3k(n_a), acc));
+        u3_noun p_d, q_d;
+
+        u3x_cell(d, &p_d, &q_d);
+        acc          = u3k(p_d);
+        fam_u->n     = u3k(q_d);
+        fam_u->sat_y = 1;
+        u3z(d);
+
+        if ( u3_nul != l_a ) {
+          fam_u = u3a_push(&pil_u);
+          fam_u->a     = l_a;
+          fam_u->sat_y = 0;
+          u3a_pile_sane(&pil_u);
+          continue;
+        }
+        pro = u3_nul;
+      }  //  fallthrough
+
+      case 1: {
+        fam_u->l     = pro;
+        fam_u->sat_y = 2;
+
+        if ( u3_nul != r_a ) {
+          fam_u = u3a_push(&pil_u);
+          fam_u->a     = r_a;
+          fam_u->sat_y = 0;
+          u3a_pile_sane(&pil_u);
+          continue;
+        }
+        pro = u3_nul;
+      }  //  fallthrough
+
+      case 2: {
+        pro   = u3nt(fam_u->n, fam_u->l, pro);
+        fam_u = u3a_pop(&pil_u);
+      } break;
+    }
+  }
+
+  u3j_gate_lose(&sit_u);
+
+  return u3nc(acc, pro);
+}
+
+u3_noun
+u3wdb_rib(u3_noun cor)
+{
+  u3_noun a, b, c;
+  u3x_mean(cor, u3x_sam_2, &b, u3x_sam_3, &c, u3x_con_sam, &a, 0);
+  return u3qdb_rib(a, b, c);
+}
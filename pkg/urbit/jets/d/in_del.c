@@ -86,3 +86,124 @@ u3wdi_del(u3_noun cor)
   u3x_mean(cor, u3x_sam, &b, u3x_con_sam, &a, 0);
   return u3qdi_del(a, b);
 }
+
+//  delete the root of [a], whose cells are owned; [a] is TRANSFERRED
+//
+static u3_noun
+_rebalance_own(u3_noun   a,
+               u3a_cell* nod_u,
+               u3a_cell* lor_u,
+               c3_o      pai_o)
+{
+  u3_noun l_a = lor_u->hed;
+  u3_noun r_a = lor_u->tel;
+
+  if ( u3_nul == l_a ) {
+    lor_u->tel = u3_nul;
+    u3z(a);
+    return r_a;
+  }
+  else if ( u3_nul == r_a ) {
+    lor_u->hed = u3_nul;
+    u3z(a);
+    return l_a;
+  }
+  else {
+    u3_noun   n_l_a = u3x_h(l_a);
+    u3_noun   n_r_a = u3x_h(r_a);
+    u3a_cell* kod_u;
+    u3a_cell* kor_u;
+
+    if ( c3y == u3qc_mor(( c3y == pai_o ) ? u3x_h(n_l_a) : n_l_a,
+                         ( c3y == pai_o ) ? u3x_h(n_r_a) : n_r_a) )
+    {
+      if ( c3y == u3qdi_own(l_a, &kod_u, &kor_u) ) {
+        lor_u->hed = kor_u->tel;
+        kor_u->tel = _rebalance_own(a, nod_u, lor_u, pai_o);
+        return l_a;
+      }
+      else {
+        u3_noun l_l_a, r_l_a, n, l;
+        u3x_trel(l_a, 0, &l_l_a, &r_l_a);
+
+        n = u3k(n_l_a);
+        l = u3k(l_l_a);
+        lor_u->hed = u3k(r_l_a);
+        u3z(l_a);
+        return u3nt(n, l, _rebalance_own(a, nod_u, lor_u, pai_o));
+      }
+    }
+    else {
+      if ( c3y == u3qdi_own(r_a, &kod_u, &kor_u) ) {
+        lor_u->tel = kor_u->hed;
+        kor_u->hed = _rebalance_own(a, nod_u, lor_u, pai_o);
+        return r_a;
+      }
+      else {
+        u3_noun l_r_a, r_r_a, n, r;
+        u3x_trel(r_a, 0, &l_r_a, &r_r_a);
+
+        n = u3k(n_r_a);
+        r = u3k(r_r_a);
+        lor_u->tel = u3k(l_r_a);
+        u3z(r_a);
+        return u3nt(n, _rebalance_own(a, nod_u, lor_u, pai_o), r);
+      }
+    }
+  }
+}
+
+//  delete key [b] from [a], keyed on node heads if [pai_o]: the
+//  map case. [a] is TRANSFERRED, [b] is RETAINED.
+//
+//  as in u3qdi_put_own(), nodes only [a] refers to are rewritten.
+//
+u3_noun
+u3qdi_del_own(u3_noun a,
+              u3_noun b,
+              c3_o    pai_o)
+{
+  u3a_cell* nod_u;
+  u3a_cell* lor_u;
+
+  if ( u3_nul == a ) {
+    return u3_nul;
+  }
+  else if ( c3n == u3qdi_own(a, &nod_u, &lor_u) ) {
+    u3_noun pro = ( c3y == pai_o )
+                  ? u3qdb_del(a, b)
+                  : u3qdi_del(a, b);
+    u3z(a);
+    return pro;
+  }
+  else {
+    u3_noun n_a = nod_u->hed;
+    u3_noun k_a = ( c3y == pai_o ) ? u3x_h(n_a) : n_a;
+    u3_noun c;
+
+    if ( c3y == u3r_sing(k_a, b) ) {
+      return _rebalance_own(a, nod_u, lor_u, pai_o);
+    }
+    else if ( c3y == u3qc_gor(b, k_a) ) {
+      c = lor_u->hed;
+      lor_u->hed = u3_nul;
+      lor_u->hed = u3qdi_del_own(c, b, pai_o);
+      return a;
+    }
+    else {
+      c = lor_u->tel;
+      lor_u->tel = u3_nul;
+      lor_u->tel = u3qdi_del_own(c, b, pai_o);
+      return a;
+    }
+  }
+}
+
+u3_noun
+u3kdi_del(u3_noun a,
+          u3_noun b)
+{
+  u3_noun pro = u3qdi_del_own(a, b, c3n);
+  u3z(b);
+  return pro;
+}
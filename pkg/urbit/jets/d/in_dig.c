@@ -0,0 +1,48 @@
+/* j/4/in_dig.c
+**
+*/
+#include "all.h"
+
+/* functions
+*/
+u3_noun
+u3qdi_dig(u3_noun a,
+          u3_noun b)
+{
+  u3_atom c = 1;
+
+  while ( u3_nul != a ) {
+    u3_noun n_a, l_a, r_a;
+    u3_atom d;
+
+    u3x_trel(a, &n_a, &l_a, &r_a);
+
+    if ( c3y == u3r_sing(b, n_a) ) {
+      d = u3qc_peg(c, 2);
+      u3z(c);
+      return u3nc(u3_nul, d);
+    }
+    else if ( c3y == u3qc_gor(b, n_a) ) {
+      d = u3qc_peg(c, 6);
+      a = l_a;
+    }
+    else {
+      d = u3qc_peg(c, 7);
+      a = r_a;
+    }
+
+    u3z(c);
+    c = d;
+  }
+
+  u3z(c);
+  return u3_nul;
+}
+
+u3_noun
+u3wdi_dig(u3_noun cor)
+{
+  u3_noun a, b;
+  u3x_mean(cor, u3x_sam, &b, u3x_con_sam, &a, 0);
+  return u3qdi_dig(a, b);
+}
@@ -5,22 +5,367 @@
 
 /* functions
 */
+
+//  lists shorter than this are put one at a time
+//
+#define GAS_BULK  16
+
+/* _gas_item: a treap node, and the mugs of its key.
+*/
+typedef struct {
+  u3_noun nod;                        //  n.a
+  u3_noun key;                        //  n.a, or p.n.a in a map
+  c3_w    gor_w;                      //  (mug key)
+  c3_w    mor_w;                      //  (mug (mug key))
+} _gas_item;
+
+static void
+_gas_item_init(_gas_item* itm_u, u3_noun nod, c3_o pai_o)
+{
+  itm_u->nod   = nod;
+  itm_u->key   = ( c3y == pai_o ) ? u3x_h(nod) : nod;
+  itm_u->gor_w = u3r_mug(itm_u->key);
+  itm_u->mor_w = u3r_mug(itm_u->gor_w);
+}
+
+//  0 if the keys are equal, else -1 if (gor a b), else 1
+//
+static c3_ws
+_gas_cmp(const _gas_item* a_u, const _gas_item* b_u)
+{
+  if ( a_u->gor_w != b_u->gor_w ) {
+    return ( a_u->gor_w < b_u->gor_w ) ? -1 : 1;
+  }
+  else if ( c3y == u3r_sing(a_u->key, b_u->key) ) {
+    return 0;
+  }
+  else {
+    return ( c3y == u3qc_dor(a_u->key, b_u->key) ) ? -1 : 1;
+  }
+}
+
+//  (mor a b): a is above b
+//
+static c3_o
+_gas_mor(const _gas_item* a_u, const _gas_item* b_u)
+{
+  if ( a_u->mor_w != b_u->mor_w ) {
+    return __(a_u->mor_w < b_u->mor_w);
+  }
+  else {
+    return u3qc_dor(a_u->key, b_u->key);
+  }
+}
+
+//  pop the road stack empty
+//
+static void
+_gas_drop(u3a_pile* pil_u)
+{
+  while ( c3n == u3a_pile_done(pil_u) ) {
+    u3a_pop(pil_u);
+  }
+}
+
+//  nodes in [a], or max_w + 1 if there are more than max_w
+//
+static c3_w
+_gas_wyt(u3_noun a, c3_w max_w)
+{
+  c3_w     wyt_w = 0;
+  u3a_pile pil_u;
+  u3_noun* top;
+  u3_noun  l_a, r_a;
+
+  if ( u3_nul == a ) {
+    return 0;
+  }
+
+  u3a_pile_prep(&pil_u, sizeof(u3_noun));
+  top  = u3a_push(&pil_u);
+  *top = a;
+
+  while ( c3n == u3a_pile_done(&pil_u) ) {
+    if ( ++wyt_w > max_w ) {
+      _gas_drop(&pil_u);
+      break;
+    }
+
+    u3x_trel(*top, 0, &l_a, &r_a);
+    top = u3a_pop(&pil_u);
+
+    if ( u3_nul != l_a ) {
+      top  = u3a_push(&pil_u);
+      *top = l_a;
+    }
+
+    if ( u3_nul != r_a ) {
+      top  = u3a_push(&pil_u);
+      *top = r_a;
+    }
+
+    u3a_pile_sane(&pil_u);
+  }
+
+  return wyt_w;
+}
+
+//  flatten [a] in order, or produce no if it is not a treap:
+//  the keys must ascend by +gor, and each node be +mor its children
+//
+static c3_o
+_gas_flat(u3_noun a, c3_o pai_o, _gas_item* itm_u)
+{
+  c3_w      len_w = 0;
+  u3a_pile  pil_u;
+  u3_noun*  top;
+  u3_noun   n_a, l_a, r_a;
+  _gas_item kid_u;
+
+  u3a_pile_prep(&pil_u, sizeof(u3_noun));
+
+  while ( 1 ) {
+    while ( u3_nul != a ) {
+      u3x_trel(a, 0, &l_a, 0);
+      top  = u3a_push(&pil_u);
+      *top = a;
+      a    = l_a;
+    }
+    u3a_pile_sane(&pil_u);
+
+    if ( c3y == u3a_pile_done(&pil_u) ) {
+      return c3y;
+    }
+
+    u3x_trel(*top, &n_a, &l_a, &r_a);
+    top = u3a_pop(&pil_u);
+
+    _gas_item_init(&itm_u[len_w], n_a, pai_o);
+
+    if ( len_w && (-1 != _gas_cmp(&itm_u[len_w - 1], &itm_u[len_w])) ) {
+      _gas_drop(&pil_u);
+      return c3n;
+    }
+
+    if ( u3_nul != l_a ) {
+      _gas_item_init(&kid_u, u3x_h(l_a), pai_o);
+
+      if ( c3n == _gas_mor(&itm_u[len_w], &kid_u) ) {
+        _gas_drop(&pil_u);
+        return c3n;
+      }
+    }
+
+    if ( u3_nul != r_a ) {
+      _gas_item_init(&kid_u, u3x_h(r_a), pai_o);
+
+      if ( c3n == _gas_mor(&itm_u[len_w], &kid_u) ) {
+        _gas_drop(&pil_u);
+        return c3n;
+      }
+    }
+
+    len_w++;
+    a = r_a;
+  }
+}
+
+//  stable merge sort by key, using tmp_u
+//
+static void
+_gas_sort(_gas_item* itm_u, _gas_item* tmp_u, c3_w len_w)
+{
+  _gas_item* src_u = itm_u;
+  _gas_item* dst_u = tmp_u;
+  c3_w       wid_w;
+
+  for ( wid_w = 1; wid_w < len_w; wid_w <<= 1 ) {
+    c3_w lo_w;
+
+    for ( lo_w = 0; lo_w < len_w; lo_w += (wid_w << 1) ) {
+      c3_w mid_w = c3_min(lo_w + wid_w, len_w);
+      c3_w hi_w  = c3_min(lo_w + (wid_w << 1), len_w);
+      c3_w i_w = lo_w, j_w = mid_w, k_w = lo_w;
+
+      while ( (i_w < mid_w) && (j_w < hi_w) ) {
+        dst_u[k_w++] = ( 0 > _gas_cmp(&src_u[j_w], &src_u[i_w]) )
+                       ? src_u[j_w++]
+                       : src_u[i_w++];
+      }
+      while ( i_w < mid_w ) {
+        dst_u[k_w++] = src_u[i_w++];
+      }
+      while ( j_w < hi_w ) {
+        dst_u[k_w++] = src_u[j_w++];
+      }
+    }
+
+    {
+      _gas_item* swp_u = src_u;
+      src_u = dst_u;
+      dst_u = swp_u;
+    }
+  }
+
+  if ( src_u != itm_u ) {
+    memcpy(itm_u, src_u, len_w * sizeof(_gas_item));
+  }
+}
+
+//  build the treap on sorted, distinct items: the unique tree
+//  ordered by +gor and heaped by +mor, which any sequence of
+//  +put produces. a node is consed when it leaves the stack, by
+//  which time both of its subtrees are complete.
+//
+static u3_noun
+_gas_tree(_gas_item* itm_u, c3_w len_w)
+{
+  c3_w*    sac_w = u3a_malloc(len_w * sizeof(c3_w));
+  u3_noun* lef   = u3a_malloc(len_w * sizeof(u3_noun));
+  c3_w     top_w = 0;
+  c3_w     i_w;
+  u3_noun  pro   = u3_nul;
+
+  for ( i_w = 0; i_w <= len_w; i_w++ ) {
+    pro = u3_nul;
+
+    while (  top_w
+          && (  (i_w == len_w)
+             || (c3y == _gas_mor(&itm_u[i_w], &itm_u[sac_w[top_w - 1]])) ) )
+    {
+      c3_w x_w = sac_w[--top_w];
+
+      //  the node above x on the stack was its right child, and has
+      //  just been consed
+      //
+      pro = u3nt(u3k(itm_u[x_w].nod), lef[x_w], pro);
+    }
+
+    if ( i_w < len_w ) {
+      lef[i_w] = pro;
+      sac_w[top_w++] = i_w;
+    }
+  }
+
+  u3a_free(sac_w);
+  u3a_free(lef);
+  return pro;
+}
+
+u3_weak
+u3qdi_gas_bulk(u3_noun a,
+               u3_noun b,
+               c3_o    pai_o)
+{
+  c3_w       len_w = 0,
+             wyt_w,
+             tot_w,
+             i_w, j_w, k_w;
+  u3_noun    t = b;
+  _gas_item* new_u;
+  _gas_item* old_u;
+  _gas_item* all_u;
+  u3_noun    pro;
+
+  while ( u3_nul != t ) {
+    u3_noun i_t;
+    u3x_cell(t, &i_t, &t);
+
+    if ( (c3y == pai_o) && (c3n == u3du(i_t)) ) {
+      return u3m_bail(c3__exit);
+    }
+    len_w++;
+  }
+
+  //  merging into a much larger tree would rebuild all of it
+  //
+  if (  (len_w < GAS_BULK)
+     || ((wyt_w = _gas_wyt(a, len_w << 3)) > (len_w << 3)) )
+  {
+    return u3_none;
+  }
+
+  old_u = u3a_malloc((wyt_w + 1) * sizeof(_gas_item));
+
+  //  a malformed tree must be put into one node at a time,
+  //  to produce exactly what the hoon would
+  //
+  if ( c3n == _gas_flat(a, pai_o, old_u) ) {
+    u3a_free(old_u);
+    return u3_none;
+  }
+
+  new_u = u3a_malloc(len_w * sizeof(_gas_item));
+  all_u = u3a_malloc((len_w + wyt_w) * sizeof(_gas_item));
+
+  for ( t = b, i_w = 0; i_w < len_w; i_w++, t = u3t(t) ) {
+    _gas_item_init(&new_u[i_w], u3h(t), pai_o);
+  }
+
+  _gas_sort(new_u, all_u, len_w);
+
+  //  the last of each run of equal keys was put last
+  //
+  for ( i_w = 0, j_w = 0; i_w < len_w; i_w++ ) {
+    if (  ((i_w + 1) < len_w)
+       && (0 == _gas_cmp(&new_u[i_w], &new_u[i_w + 1])) )
+    {
+      continue;
+    }
+    new_u[j_w++] = new_u[i_w];
+  }
+  len_w = j_w;
+
+  for ( i_w = 0, j_w = 0, k_w = 0; (i_w < len_w) || (j_w < wyt_w); k_w++ ) {
+    if ( i_w == len_w ) {
+      all_u[k_w] = old_u[j_w++];
+    }
+    else if ( j_w == wyt_w ) {
+      all_u[k_w] = new_u[i_w++];
+    }
+    else {
+      c3_ws cmp_ws = _gas_cmp(&new_u[i_w], &old_u[j_w]);
+
+      if ( 0 > cmp_ws ) {
+        all_u[k_w] = new_u[i_w++];
+      }
+      else if ( 0 < cmp_ws ) {
+        all_u[k_w] = old_u[j_w++];
+      }
+      else {
+        all_u[k_w] = new_u[i_w++];
+        j_w++;
+      }
+    }
+  }
+  tot_w = k_w;
+
+  pro = _gas_tree(all_u, tot_w);
+
+  u3a_free(all_u);
+  u3a_free(new_u);
+  u3a_free(old_u);
+  return pro;
+}
+
 u3_noun
 u3qdi_gas(u3_noun a,
           u3_noun b)
 {
-  if ( u3_nul == b ) {
-    return u3k(a);
-  }
-  else {
-    u3_noun i_b, t_b;
-    u3x_cell(b, &i_b, &t_b);
+  u3_weak pro = u3qdi_gas_bulk(a, b, c3n);
 
-    u3_noun c = u3qdi_put(a, i_b);
-    u3_noun d = u3qdi_gas(c, t_b);
-    u3z(c);
-    return d;
+  if ( u3_none == pro ) {
+    u3_noun i_b;
+
+    pro = u3k(a);
+
+    while ( u3_nul != b ) {
+      u3x_cell(b, &i_b, &b);
+      pro = u3kdi_put(pro, u3k(i_b));
+    }
   }
+
+  return pro;
 }
 
 u3_noun
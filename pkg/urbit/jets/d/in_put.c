@@ -76,11 +76,127 @@ u3wdi_put(u3_noun cor)
   return u3qdi_put(a, b);
 }
 
+//  a treap node [n l r] is two cells, [n lr] and [l r]; produces
+//  them if nothing but [a] refers to them, so they can be rewritten
+//
+c3_o
+u3qdi_own(u3_noun a, u3a_cell** nod_u, u3a_cell** lor_u)
+{
+  if ( c3n == u3a_is_mutable(u3R, a) ) {
+    return c3n;
+  }
+  else {
+    *nod_u = (void*)u3a_to_ptr(a);
+
+    if ( c3n == u3a_is_mutable(u3R, (*nod_u)->tel) ) {
+      return c3n;
+    }
+    else {
+      *lor_u = (void*)u3a_to_ptr((*nod_u)->tel);
+      (*nod_u)->mug_w = 0;
+      (*lor_u)->mug_w = 0;
+      return c3y;
+    }
+  }
+}
+
+//  put node [b] into [a], keyed on its head if [pai_o]: the map
+//  case. [a] is TRANSFERRED, [b] is RETAINED.
+//
+//  nodes of [a] are rewritten in place while only [a] refers to
+//  them; below the first shared node, the path is copied as usual.
+//
+u3_noun
+u3qdi_put_own(u3_noun a,
+              u3_noun b,
+              c3_o    pai_o)
+{
+  u3a_cell* nod_u;
+  u3a_cell* lor_u;
+  u3_noun   key = ( c3y == pai_o ) ? u3x_h(b) : b;
+
+  if ( u3_nul == a ) {
+    return u3nt(u3k(b), u3_nul, u3_nul);
+  }
+  else if ( c3n == u3qdi_own(a, &nod_u, &lor_u) ) {
+    u3_noun pro = ( c3y == pai_o )
+                  ? u3qdb_put(a, key, u3t(b))
+                  : u3qdi_put(a, b);
+    u3z(a);
+    return pro;
+  }
+  else {
+    u3_noun n_a = nod_u->hed;
+    u3_noun k_a = ( c3y == pai_o ) ? u3x_h(n_a) : n_a;
+    u3_noun c, k_c;
+    u3a_cell* noc_u;
+    u3a_cell* loc_u;
+
+    if ( c3y == u3r_sing(k_a, key) ) {
+      if ( (c3y == pai_o) && (c3n == u3r_sing(n_a, b)) ) {
+        nod_u->hed = u3k(b);
+        u3z(n_a);
+      }
+      return a;
+    }
+    else if ( c3y == u3qc_gor(key, k_a) ) {
+      c = lor_u->hed;
+      lor_u->hed = u3_nul;
+      c   = u3qdi_put_own(c, b, pai_o);
+      k_c = ( c3y == pai_o ) ? u3h(u3h(c)) : u3h(c);
+
+      if ( c3y == u3qc_mor(k_a, k_c) ) {
+        lor_u->hed = c;
+        return a;
+      }
+      else if ( c3y == u3qdi_own(c, &noc_u, &loc_u) ) {
+        lor_u->hed = loc_u->tel;
+        loc_u->tel = a;
+        return c;
+      }
+      else {
+        u3_noun n_c, l_c, r_c, d;
+        u3x_trel(c, &n_c, &l_c, &r_c);
+
+        lor_u->hed = u3k(r_c);
+        d = u3nt(u3k(n_c), u3k(l_c), a);
+        u3z(c);
+        return d;
+      }
+    }
+    else {
+      c = lor_u->tel;
+      lor_u->tel = u3_nul;
+      c   = u3qdi_put_own(c, b, pai_o);
+      k_c = ( c3y == pai_o ) ? u3h(u3h(c)) : u3h(c);
+
+      if ( c3y == u3qc_mor(k_a, k_c) ) {
+        lor_u->tel = c;
+        return a;
+      }
+      else if ( c3y == u3qdi_own(c, &noc_u, &loc_u) ) {
+        lor_u->tel = loc_u->hed;
+        loc_u->hed = a;
+        return c;
+      }
+      else {
+        u3_noun n_c, l_c, r_c, d;
+        u3x_trel(c, &n_c, &l_c, &r_c);
+
+        lor_u->tel = u3k(l_c);
+        d = u3nt(u3k(n_c), a, u3k(r_c));
+        u3z(c);
+        return d;
+      }
+    }
+  }
+}
+
 u3_noun
 u3kdi_put(u3_noun a,
           u3_noun b)
 {
-  u3_noun pro = u3qdi_put(a, b);
-  u3z(a); u3z(b);
+  u3_noun pro = u3qdi_put_own(a, b, c3n);
+  u3z(b);
   return pro;
 }
@@ -3,34 +3,46 @@
 */
 #include "all.h"
 
-//  [a] is RETAINED, [out] is TRANSFERRED
-//
-static void
-_in_rep(u3_noun a, u3j_site* sit_u, u3_noun* out)
+u3_noun
+u3qdi_rep(u3_noun a, u3_noun b)
 {
-  if ( u3_nul == a ) {
-    return;
-  }
-  else {
-    u3_noun n_a, l_a, r_a;
-    u3x_trel(a, &n_a, &l_a, &r_a);
+  u3_noun out = u3k(u3x_at(u3x_sam_3, b));
 
-    *out = u3j_gate_slam(sit_u, u3nc(u3k(n_a), *out));
+  if ( u3_nul != a ) {
+    u3a_pile pil_u;
+    u3j_site sit_u;
+    u3_noun* top;
+    u3_noun  n_a, l_a, r_a;
 
-    _in_rep(l_a, sit_u, out);
-    _in_rep(r_a, sit_u, out);
-  }
-}
+    u3a_pile_prep(&pil_u, sizeof(u3_noun));
+    top  = u3a_push(&pil_u);
+    *top = a;
 
-u3_noun
-u3qdi_rep(u3_noun a, u3_noun b)
-{
-  u3_noun    out = u3k(u3x_at(u3x_sam_3, b));
-  u3j_site sit_u;
+    u3j_gate_prep(&sit_u, u3k(b));
+
+    //  preorder: node, then left, then right
+    //
+    while ( c3n == u3a_pile_done(&pil_u) ) {
+      u3x_trel(*top, &n_a, &l_a, &r_a);
+      top = u3a_pop(&pil_u);
+
+      out = u3j_gate_slam(&sit_u, u3nc(u3k(n_a), out));
+
+      if ( u3_nul != r_a ) {
+        top  = u3a_push(&pil_u);
+        *top = r_a;
+      }
 
-  u3j_gate_prep(&sit_u, u3k(b));
-  _in_rep(a, &sit_u, &out);
-  u3j_gate_lose(&sit_u);
+      if ( u3_nul != l_a ) {
+        top  = u3a_push(&pil_u);
+        *top = l_a;
+      }
+
+      u3a_pile_sane(&pil_u);
+    }
+
+    u3j_gate_lose(&sit_u);
+  }
 
   return out;
 }
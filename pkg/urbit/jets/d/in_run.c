@@ -15,14 +15,7 @@ _in_run(u3_noun a, u3j_site* sit_u, u3_noun* out)
     u3_noun n_a, l_a, r_a;
     u3x_trel(a, &n_a, &l_a, &r_a);
 
-    {
-      u3_noun new = u3j_gate_slam(sit_u, u3k(n_a));
-      u3_noun pro = u3qdi_put(*out, new);
-
-      u3z(new);
-      u3z(*out);
-      *out = pro;
-    }
+    *out = u3kdi_put(*out, u3j_gate_slam(sit_u, u3k(n_a)));
 
     _in_run(l_a, sit_u, out);
     _in_run(r_a, sit_u, out);
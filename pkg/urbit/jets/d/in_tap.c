@@ -5,27 +5,42 @@
 
 /* functions
 */
-static u3_noun
-_tap_in(u3_noun a,
-        u3_noun b)
+u3_noun
+u3qdi_tap(u3_noun a)
 {
-  if ( u3_nul == a ) {
-    return b;
-  }
-  else {
-    u3_noun n_a, l_a, r_a;
-    u3x_trel(a, &n_a, &l_a, &r_a);
+  u3_noun pro = u3_nul;
+
+  if ( u3_nul != a ) {
+    u3a_pile pil_u;
+    u3_noun* top;
+    u3_noun  n_a, l_a, r_a;
+
+    u3a_pile_prep(&pil_u, sizeof(u3_noun));
+
+    //  in order, consing each node onto the product,
+    //  which thus lists the rightmost node first
+    //
+    while ( 1 ) {
+      while ( u3_nul != a ) {
+        u3x_trel(a, 0, &l_a, 0);
+        top  = u3a_push(&pil_u);
+        *top = a;
+        a    = l_a;
+      }
+      u3a_pile_sane(&pil_u);
 
-    return _tap_in(r_a,
-                   u3nc(u3k(n_a),
-                   _tap_in(l_a, b)));
+      if ( c3y == u3a_pile_done(&pil_u) ) {
+        break;
+      }
+
+      u3x_trel(*top, &n_a, 0, &r_a);
+      top = u3a_pop(&pil_u);
+      pro = u3nc(u3k(n_a), pro);
+      a   = r_a;
+    }
   }
-}
 
-u3_noun
-u3qdi_tap(u3_noun a)
-{
-  return _tap_in(a, u3_nul);
+  return pro;
 }
 
 u3_noun
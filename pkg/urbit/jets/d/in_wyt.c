@@ -9,15 +9,38 @@ STATIC_ASSERT( (UINT32_MAX > u3a_cells),
 static c3_w
 _wyt_in(u3_noun a)
 {
+  c3_w     len_w = 0;
+  u3a_pile pil_u;
+  u3_noun* top;
+  u3_noun  l_a, r_a;
+
   if ( u3_nul == a ) {
     return 0;
   }
-  else {
-    u3_noun l_a, r_a;
-    u3x_trel(a, 0, &l_a, &r_a);
 
-    return 1 + _wyt_in(l_a) + _wyt_in(r_a);
+  u3a_pile_prep(&pil_u, sizeof(u3_noun));
+  top  = u3a_push(&pil_u);
+  *top = a;
+
+  while ( c3n == u3a_pile_done(&pil_u) ) {
+    u3x_trel(*top, 0, &l_a, &r_a);
+    top = u3a_pop(&pil_u);
+    len_w++;
+
+    if ( u3_nul != l_a ) {
+      top  = u3a_push(&pil_u);
+      *top = l_a;
+    }
+
+    if ( u3_nul != r_a ) {
+      top  = u3a_push(&pil_u);
+      *top = r_a;
+    }
+
+    u3a_pile_sane(&pil_u);
   }
+
+  return len_w;
 }
 
 u3_noun
@@ -151,3 +151,198 @@ u3we_de_base16(u3_noun cor)
   u3_noun sam = u3x_at(u3x_sam, cor);
   return u3qe_de_base16(u3x_atom(sam));
 }
+
+static const c3_c* b64_c[2] = {
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+};
+
+u3_noun
+u3qe_en_base64(u3_atom pad, u3_atom url, u3_atom len, u3_atom dat)
+{
+  if ( c3n == u3a_is_cat(len) ) {
+    return u3m_bail(c3__fail);
+  }
+  else if ( ((c3y != pad) && (c3n != pad)) || ((c3y != url) && (c3n != url)) ) {
+    return u3m_bail(c3__exit);
+  }
+  else {
+    const c3_c* alf_c = b64_c[c3y == url];
+    c3_w        len_w = (c3_w)len;
+    c3_w        rem_w = len_w % 3;
+    c3_d        out_d = (c3_d)(len_w / 3) << 2;
+    c3_y*       inp_y;
+    u3i_slab    sab_u;
+
+    if ( rem_w ) {
+      out_d += ( c3y == pad ) ? 4 : (rem_w + 1);
+    }
+
+    if ( !out_d ) {
+      return 0;
+    }
+
+    inp_y = u3a_malloc(len_w);
+    u3r_bytes(0, len_w, inp_y, dat);
+    u3i_slab_bare(&sab_u, 3, out_d);
+    sab_u.buf_w[sab_u.len_w - 1] = 0;
+
+    //  whole 3-byte groups, then the remainder, zero-extended;
+    //  with .pad, the characters past the input are '='
+    //
+    {
+      c3_y* buf_y = sab_u.buf_y;
+      c3_y* byt_y = inp_y;
+      c3_w  grp_w = len_w / 3;
+      c3_w  wor_w;
+
+      while ( grp_w-- ) {
+        wor_w = (byt_y[0] << 16) | (byt_y[1] << 8) | byt_y[2];
+        byt_y += 3;
+
+        *buf_y++ = alf_c[(wor_w >> 18) & 63];
+        *buf_y++ = alf_c[(wor_w >> 12) & 63];
+        *buf_y++ = alf_c[(wor_w >>  6) & 63];
+        *buf_y++ = alf_c[wor_w & 63];
+      }
+
+      if ( rem_w ) {
+        wor_w = (byt_y[0] << 16) | ((2 == rem_w) ? (byt_y[1] << 8) : 0);
+
+        *buf_y++ = alf_c[(wor_w >> 18) & 63];
+        *buf_y++ = alf_c[(wor_w >> 12) & 63];
+
+        if ( 2 == rem_w ) {
+          *buf_y++ = alf_c[(wor_w >> 6) & 63];
+        }
+
+        if ( c3y == pad ) {
+          *buf_y++ = '=';
+
+          if ( 1 == rem_w ) {
+            *buf_y++ = '=';
+          }
+        }
+      }
+    }
+
+    u3a_free(inp_y);
+    return u3i_slab_mint_bytes(&sab_u);
+  }
+}
+
+static inline c3_w
+_of_b64_digit(c3_y inp_y, c3_o url_o)
+{
+  if ( inp_y >= 'A' && inp_y <= 'Z' ) {
+    return inp_y - 'A';
+  }
+  else if ( inp_y >= 'a' && inp_y <= 'z' ) {
+    return inp_y - 'G';
+  }
+  else if ( inp_y >= '0' && inp_y <= '9' ) {
+    return inp_y + 4;
+  }
+  else if ( inp_y == ((c3y == url_o) ? '-' : '+') ) {
+    return 62;
+  }
+  else if ( inp_y == ((c3y == url_o) ? '_' : '/') ) {
+    return 63;
+  }
+
+  return 64;
+}
+
+u3_noun
+u3qe_de_base64(u3_atom pad, u3_atom url, u3_atom inp)
+{
+  if ( ((c3y != pad) && (c3n != pad)) || ((c3y != url) && (c3n != url)) ) {
+    return u3m_bail(c3__exit);
+  }
+  else {
+    c3_w  byt_w = u3r_met(3, inp);
+    c3_y* inp_y = u3a_malloc(byt_w + 1);
+    c3_w  lat_w = 0, lap_w = 0, dif_w, len_w, out_w, i_w;
+    c3_y* out_y;
+    u3_noun pro;
+
+    u3r_bytes(0, byt_w, inp_y, inp);
+
+    //  digits, then up to two '=', then the end
+    //
+    while ( (lat_w < byt_w) && (64 > _of_b64_digit(inp_y[lat_w], url)) ) {
+      lat_w++;
+    }
+
+    while ( (lap_w < 2) && ((lat_w + lap_w) < byt_w)
+         && ('=' == inp_y[lat_w + lap_w]) )
+    {
+      lap_w++;
+    }
+
+    if ( !lat_w || ((lat_w + lap_w) != byt_w) ) {
+      u3a_free(inp_y);
+      return u3_nul;
+    }
+
+    dif_w = (4 - (lat_w & 3)) & 3;
+
+    //  bad padding is reported by the hoon, so punt
+    //
+    if ( (c3y == pad) ? (dif_w != lap_w) : (0 != lap_w) ) {
+      u3a_free(inp_y);
+      return u3_none;
+    }
+
+    //  the digits, zero-extended to whole groups, are decoded
+    //  MSB-first. the hoon byte-swaps this as an atom, so leading
+    //  zero bytes are dropped from the product, and .p does not
+    //  count them out.
+    //
+    out_w = ((lat_w + dif_w) >> 2) * 3;
+    len_w = out_w - dif_w;
+    out_y = u3a_malloc(out_w);
+
+    {
+      c3_w wor_w = 0;
+
+      for ( i_w = 0; i_w < (lat_w + dif_w); i_w++ ) {
+        wor_w = (wor_w << 6)
+              | ((i_w < lat_w) ? _of_b64_digit(inp_y[i_w], url) : 0);
+
+        if ( 3 == (i_w & 3) ) {
+          c3_y* buf_y = out_y + ((i_w >> 2) * 3);
+
+          buf_y[0] = (wor_w >> 16) & 0xff;
+          buf_y[1] = (wor_w >>  8) & 0xff;
+          buf_y[2] = wor_w & 0xff;
+          wor_w = 0;
+        }
+      }
+    }
+
+    for ( i_w = 0; (i_w < out_w) && !out_y[i_w]; i_w++ );
+
+    pro = u3nt(u3_nul, u3i_word(len_w), u3i_bytes(out_w - i_w, out_y + i_w));
+
+    u3a_free(out_y);
+    u3a_free(inp_y);
+    return pro;
+  }
+}
+
+u3_noun
+u3we_en_base64(u3_noun cor)
+{
+  u3_noun pad, url, a, b;
+  u3x_mean(cor, u3x_sam_2, &a, u3x_sam_3, &b, 252, &pad, 253, &url, 0);
+  return u3qe_en_base64(pad, url, u3x_atom(a), u3x_atom(b));
+}
+
+u3_noun
+u3we_de_base64(u3_noun cor)
+{
+  u3_noun pad, url, sam;
+  u3x_mean(cor, u3x_sam, &sam, 60, &pad, 61, &url, 0);
+  return u3qe_de_base64(pad, url, u3x_atom(sam));
+}
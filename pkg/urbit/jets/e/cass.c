@@ -0,0 +1,58 @@
+/* j/5/cass.c
+**
+*/
+#include "all.h"
+
+/* _cass_down(): lowercase a character.
+*/
+static u3_noun
+_cass_down(u3_noun a)
+{
+  return ( (a >= 'A') && (a <= 'Z') ) ? (a + 32) : a;
+}
+
+u3_noun
+u3qe_cass(u3_noun vib)
+{
+  u3_noun  pro;
+  u3_noun* hed;
+  u3_noun* tel;
+  u3_noun* lit = &pro;
+  u3_noun    t = vib;
+  u3_noun  las = u3_nul;
+
+  //  validate, and find the last character that changes;
+  //  the list after it is kept as it is
+  //
+  while ( u3_nul != t ) {
+    u3_noun i;
+
+    if ( (c3n == u3du(t)) || (c3n == u3ud(i = u3h(t))) ) {
+      return u3m_bail(c3__exit);
+    }
+    if ( i != _cass_down(i) ) {
+      las = t;
+    }
+    t = u3t(t);
+  }
+
+  if ( u3_nul == las ) {
+    return u3k(vib);
+  }
+
+  for ( t = vib; t != las; t = u3t(t) ) {
+    *lit = u3i_defcons(&hed, &tel);
+    *hed = _cass_down(u3h(t));
+    lit  = tel;
+  }
+
+  *lit = u3nc(_cass_down(u3h(las)), u3k(u3t(las)));
+
+  return pro;
+}
+
+u3_noun
+u3we_cass(u3_noun cor)
+{
+  return u3qe_cass(u3x_at(u3x_sam, cor));
+}
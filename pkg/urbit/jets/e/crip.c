@@ -0,0 +1,16 @@
+/* j/5/crip.c
+**
+*/
+#include "all.h"
+
+u3_noun
+u3qe_crip(u3_noun a)
+{
+  return u3qc_rap(3, a);
+}
+
+u3_noun
+u3we_crip(u3_noun cor)
+{
+  return u3qe_crip(u3x_at(u3x_sam, cor));
+}
@@ -0,0 +1,695 @@
+/* j/5/json.c
+**
+*/
+#include "all.h"
+
+//  nesting past this depth punts to the hoon
+//
+#define JSON_DEEP  1024
+
+/* en-json
+*/
+  typedef struct _json_en {
+    c3_y* buf_y;                        //  output
+    c3_w  len_w;                        //  output length
+    c3_w  siz_w;                        //  output capacity
+    c3_y* tmp_y;                        //  scratch for string bytes
+    c3_w  tmp_w;                        //  scratch capacity
+    c3_w  dep_w;                        //  nesting depth
+  } _json_en;
+
+  //  reserve len_w more bytes of output
+  //
+  static c3_y*
+  _json_en_grow(_json_en* enj_u, c3_w len_w)
+  {
+    if ( (enj_u->siz_w - enj_u->len_w) < len_w ) {
+      c3_d siz_d = (c3_d)enj_u->len_w + len_w;
+
+      siz_d += siz_d >> 1;
+
+      if ( siz_d > 0xffffffffULL ) {
+        u3m_bail(c3__fail);
+      }
+
+      enj_u->siz_w = (c3_w)siz_d;
+      enj_u->buf_y = u3a_realloc(enj_u->buf_y, enj_u->siz_w);
+    }
+
+    return enj_u->buf_y + enj_u->len_w;
+  }
+
+  static void
+  _json_en_put(_json_en* enj_u, const c3_c* str_c, c3_w len_w)
+  {
+    memcpy(_json_en_grow(enj_u, len_w), str_c, len_w);
+    enj_u->len_w += len_w;
+  }
+
+  //  (trip a)
+  //
+  static void
+  _json_en_trip(_json_en* enj_u, u3_atom a)
+  {
+    c3_w len_w = u3r_met(3, a);
+
+    u3r_bytes(0, len_w, _json_en_grow(enj_u, len_w), a);
+    enj_u->len_w += len_w;
+  }
+
+  //  a quoted string, each byte escaped by +jesc
+  //
+  static void
+  _json_en_stri(_json_en* enj_u, u3_atom a)
+  {
+    static const c3_y hex_y[16] = { '0', '1', '2', '3', '4', '5', '6', '7',
+                                    '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+    c3_w  len_w = u3r_met(3, a);
+    c3_y* out_y;
+    c3_w  i_w;
+
+    if ( enj_u->tmp_w < len_w ) {
+      enj_u->tmp_w = len_w;
+      enj_u->tmp_y = u3a_realloc(enj_u->tmp_y, len_w);
+    }
+    u3r_bytes(0, len_w, enj_u->tmp_y, a);
+
+    //  at most six bytes per byte, and the quotes
+    //
+    if ( len_w > ((0xffffffff - 2) / 6) ) {
+      u3m_bail(c3__fail);
+    }
+    out_y = _json_en_grow(enj_u, (6 * len_w) + 2);
+
+    *out_y++ = '"';
+
+    for ( i_w = 0; i_w < len_w; i_w++ ) {
+      c3_y byt_y = enj_u->tmp_y[i_w];
+
+      switch ( byt_y ) {
+        case 10: {
+          *out_y++ = '\\'; *out_y++ = 'n';
+        } break;
+
+        case '"': {
+          *out_y++ = '\\'; *out_y++ = '"';
+        } break;
+
+        case '\\': {
+          *out_y++ = '\\'; *out_y++ = '\\';
+        } break;
+
+        default: {
+          if ( byt_y > 0x1f ) {
+            *out_y++ = byt_y;
+          }
+          else {
+            *out_y++ = '\\'; *out_y++ = 'u';
+            *out_y++ = '0';  *out_y++ = '0';
+            *out_y++ = hex_y[byt_y >> 4];
+            *out_y++ = hex_y[byt_y & 0xf];
+          }
+        } break;
+      }
+    }
+
+    *out_y++ = '"';
+    enj_u->len_w = out_y - enj_u->buf_y;
+  }
+
+  static c3_o _json_en_apex(_json_en* enj_u, u3_noun val);
+
+  //  pairs of an object, in +tap:by order (right, node, left)
+  //
+  static c3_o
+  _json_en_pear(_json_en* enj_u, u3_noun a, c3_o* fir_o)
+  {
+    u3_noun n, l, r, p, q;
+
+    if ( u3_nul == a ) {
+      return c3y;
+    }
+
+    u3x_trel(a, &n, &l, &r);
+    u3x_cell(n, &p, &q);
+
+    if ( c3n == _json_en_pear(enj_u, r, fir_o) ) {
+      return c3n;
+    }
+
+    if ( c3n == *fir_o ) {
+      _json_en_put(enj_u, ",", 1);
+    }
+    *fir_o = c3n;
+
+    _json_en_stri(enj_u, u3x_atom(p));
+    _json_en_put(enj_u, ":", 1);
+
+    if ( c3n == _json_en_apex(enj_u, q) ) {
+      return c3n;
+    }
+
+    return _json_en_pear(enj_u, l, fir_o);
+  }
+
+  //  print val, or produce no to punt
+  //
+  static c3_o
+  _json_en_apex(_json_en* enj_u, u3_noun val)
+  {
+    u3_noun tag, dat;
+    c3_o    ret_o = c3y;
+
+    if ( u3_nul == val ) {
+      _json_en_put(enj_u, "null", 4);
+      return c3y;
+    }
+
+    if ( JSON_DEEP <= enj_u->dep_w ) {
+      return c3n;
+    }
+    enj_u->dep_w++;
+
+    u3x_cell(val, &tag, &dat);
+
+    switch ( tag ) {
+      default: return u3m_bail(c3__exit);
+
+      case c3__a: {
+        u3_noun i;
+
+        _json_en_put(enj_u, "[", 1);
+
+        while ( (c3y == ret_o) && (u3_nul != dat) ) {
+          u3x_cell(dat, &i, &dat);
+          ret_o = _json_en_apex(enj_u, i);
+
+          if ( u3_nul != dat ) {
+            _json_en_put(enj_u, ",", 1);
+          }
+        }
+
+        _json_en_put(enj_u, "]", 1);
+      } break;
+
+      case c3__b: {
+        switch ( dat ) {
+          default:  return u3m_bail(c3__exit);
+          case c3y: _json_en_put(enj_u, "true", 4);  break;
+          case c3n: _json_en_put(enj_u, "false", 5); break;
+        }
+      } break;
+
+      case c3__n: {
+        _json_en_trip(enj_u, u3x_atom(dat));
+      } break;
+
+      case c3__s: {
+        _json_en_stri(enj_u, u3x_atom(dat));
+      } break;
+
+      case c3__o: {
+        c3_o fir_o = c3y;
+
+        _json_en_put(enj_u, "{", 1);
+        ret_o = _json_en_pear(enj_u, dat, &fir_o);
+        _json_en_put(enj_u, "}", 1);
+      } break;
+    }
+
+    enj_u->dep_w--;
+    return ret_o;
+  }
+
+  u3_noun
+  u3qe_en_json(u3_noun val)
+  {
+    _json_en enj_u;
+    u3_noun  pro = u3_nul;
+    c3_o     ret_o;
+
+    enj_u.siz_w = 256;
+    enj_u.len_w = 0;
+    enj_u.buf_y = u3a_malloc(enj_u.siz_w);
+    enj_u.tmp_w = 0;
+    enj_u.tmp_y = 0;
+    enj_u.dep_w = 0;
+
+    ret_o = _json_en_apex(&enj_u, val);
+
+    if ( c3y == ret_o ) {
+      c3_w i_w = enj_u.len_w;
+
+      while ( i_w-- ) {
+        pro = u3nc(enj_u.buf_y[i_w], pro);
+      }
+    }
+
+    u3a_free(enj_u.buf_y);
+    if ( enj_u.tmp_y ) {
+      u3a_free(enj_u.tmp_y);
+    }
+
+    return ( c3y == ret_o ) ? pro : u3_none;
+  }
+
+  u3_noun
+  u3we_en_json(u3_noun cor)
+  {
+    return u3qe_en_json(u3x_at(u3x_sam, cor));
+  }
+
+/* de-json
+**
+**   a recursive-descent transcription of the +de-json parser.
+**   each rule either consumes input and succeeds or consumes
+**   nothing and fails; the alternatives of +apex are told apart
+**   by their first character.
+*/
+  typedef struct _json_de {
+    c3_y* byt_y;                        //  input
+    c3_w  len_w;                        //  input length
+    c3_w  pos_w;                        //  cursor
+    c3_y* tmp_y;                        //  scratch for string bytes
+    c3_w  dep_w;                        //  nesting depth
+    c3_o  pun_o;                        //  too deep, punt
+  } _json_de;
+
+  //  the byte at the cursor, or 256 at the end
+  //
+  static inline c3_w
+  _json_de_peek(_json_de* dej_u)
+  {
+    return ( dej_u->pos_w < dej_u->len_w )
+           ? dej_u->byt_y[dej_u->pos_w]
+           : 256;
+  }
+
+  static inline c3_o
+  _json_de_digit(c3_w c_w)
+  {
+    return __( (c_w >= '0') && (c_w <= '9') );
+  }
+
+  //  +spac
+  //
+  static void
+  _json_de_spac(_json_de* dej_u)
+  {
+    while ( 1 ) {
+      switch ( _json_de_peek(dej_u) ) {
+        default: return;
+
+        case 9:
+        case 10:
+        case 13:
+        case ' ': {
+          dej_u->pos_w++;
+        } break;
+      }
+    }
+  }
+
+  //  (jest str_c)
+  //
+  static c3_o
+  _json_de_jest(_json_de* dej_u, const c3_c* str_c)
+  {
+    c3_w len_w = strlen(str_c);
+
+    if (  ((dej_u->len_w - dej_u->pos_w) < len_w)
+       || memcmp(dej_u->byt_y + dej_u->pos_w, str_c, len_w) )
+    {
+      return c3n;
+    }
+
+    dej_u->pos_w += len_w;
+    return c3y;
+  }
+
+  //  +stri: only the escapes of +esca; \u takes exactly four
+  //  lowercase hex digits, encoded by +tuft (so \u0000 is dropped)
+  //
+  static c3_o
+  _json_de_stri(_json_de* dej_u, u3_noun* out)
+  {
+    c3_y* byt_y = dej_u->byt_y;
+    c3_y* tmp_y = dej_u->tmp_y;
+    c3_w  pos_w = dej_u->pos_w + 1;
+    c3_w  len_w = 0;
+    c3_y  c_y;
+
+    while ( 1 ) {
+      if ( pos_w >= dej_u->len_w ) {
+        return c3n;
+      }
+
+      c_y = byt_y[pos_w++];
+
+      if ( '"' == c_y ) {
+        break;
+      }
+      else if ( '\\' != c_y ) {
+        if ( (c_y < 32) || (127 == c_y) ) {
+          return c3n;
+        }
+        tmp_y[len_w++] = c_y;
+      }
+      else {
+        if ( pos_w >= dej_u->len_w ) {
+          return c3n;
+        }
+
+        switch ( byt_y[pos_w++] ) {
+          default: return c3n;
+
+          case '"':  tmp_y[len_w++] = '"';  break;
+          case '/':  tmp_y[len_w++] = '/';  break;
+          case '\'': tmp_y[len_w++] = '\''; break;
+          case '\\': tmp_y[len_w++] = '\\'; break;
+          case 'b':  tmp_y[len_w++] = 8;    break;
+          case 't':  tmp_y[len_w++] = 9;    break;
+          case 'n':  tmp_y[len_w++] = 10;   break;
+          case 'f':  tmp_y[len_w++] = 12;   break;
+          case 'r':  tmp_y[len_w++] = 13;   break;
+
+          case 'u': {
+            c3_w cod_w = 0, i_w;
+
+            if ( (dej_u->len_w - pos_w) < 4 ) {
+              return c3n;
+            }
+
+            for ( i_w = 0; i_w < 4; i_w++ ) {
+              c_y = byt_y[pos_w++];
+
+              if ( (c_y >= '0') && (c_y <= '9') ) {
+                cod_w = (cod_w << 4) | (c_y - '0');
+              }
+              else if ( (c_y >= 'a') && (c_y <= 'f') ) {
+                cod_w = (cod_w << 4) | (c_y - 87);
+              }
+              else {
+                return c3n;
+              }
+            }
+
+            if ( !cod_w ) {
+              break;
+            }
+            else if ( cod_w <= 0x7f ) {
+              tmp_y[len_w++] = cod_w;
+            }
+            else if ( cod_w <= 0x7ff ) {
+              tmp_y[len_w++] = 0xc0 | (cod_w >> 6);
+              tmp_y[len_w++] = 0x80 | (cod_w & 0x3f);
+            }
+            else {
+              tmp_y[len_w++] = 0xe0 | (cod_w >> 12);
+              tmp_y[len_w++] = 0x80 | ((cod_w >> 6) & 0x3f);
+              tmp_y[len_w++] = 0x80 | (cod_w & 0x3f);
+            }
+          } break;
+        }
+      }
+    }
+
+    *out = u3i_bytes(len_w, tmp_y);
+    dej_u->pos_w = pos_w;
+    return c3y;
+  }
+
+  //  +numb: the digits of a fraction or exponent may be empty
+  //
+  static c3_o
+  _json_de_numb(_json_de* dej_u, u3_noun* out)
+  {
+    c3_w pos_w = dej_u->pos_w;
+
+    if ( '-' == _json_de_peek(dej_u) ) {
+      dej_u->pos_w++;
+    }
+
+    if ( '0' == _json_de_peek(dej_u) ) {
+      dej_u->pos_w++;
+    }
+    else if ( c3y == _json_de_digit(_json_de_peek(dej_u)) ) {
+      do {
+        dej_u->pos_w++;
+      } while ( c3y == _json_de_digit(_json_de_peek(dej_u)) );
+    }
+    else {
+      dej_u->pos_w = pos_w;
+      return c3n;
+    }
+
+    if ( '.' == _json_de_peek(dej_u) ) {
+      do {
+        dej_u->pos_w++;
+      } while ( c3y == _json_de_digit(_json_de_peek(dej_u)) );
+    }
+
+    switch ( _json_de_peek(dej_u) ) {
+      case 'e':
+      case 'E': {
+        dej_u->pos_w++;
+
+        switch ( _json_de_peek(dej_u) ) {
+          case '+':
+          case '-': dej_u->pos_w++;
+        }
+
+        while ( c3y == _json_de_digit(_json_de_peek(dej_u)) ) {
+          dej_u->pos_w++;
+        }
+      } break;
+    }
+
+    *out = u3nc(c3__n, u3i_bytes(dej_u->pos_w - pos_w,
+                                 dej_u->byt_y + pos_w));
+    return c3y;
+  }
+
+  static c3_o _json_de_apex(_json_de* dej_u, u3_noun* out);
+
+  //  +pear: key-value
+  //
+  static c3_o
+  _json_de_pear(_json_de* dej_u, u3_noun* out)
+  {
+    c3_w    pos_w = dej_u->pos_w;
+    u3_noun key, val;
+
+    _json_de_spac(dej_u);
+
+    if (  ('"' != _json_de_peek(dej_u))
+       || (c3n == _json_de_stri(dej_u, &key)) )
+    {
+      dej_u->pos_w = pos_w;
+      return c3n;
+    }
+
+    _json_de_spac(dej_u);
+
+    if ( ':' != _json_de_peek(dej_u) ) {
+      u3z(key);
+      dej_u->pos_w = pos_w;
+      return c3n;
+    }
+    dej_u->pos_w++;
+
+    if ( c3n == _json_de_apex(dej_u, &val) ) {
+      u3z(key);
+      dej_u->pos_w = pos_w;
+      return c3n;
+    }
+
+    *out = u3nc(key, val);
+    return c3y;
+  }
+
+  //  +abox and +obje: (more (wish com) fel) between delimiters;
+  //  a separator is only consumed if the item after it parses
+  //
+  static c3_o
+  _json_de_more(_json_de* dej_u,
+                c3_y      end_y,
+                c3_o    (*fel_f)(_json_de*, u3_noun*),
+                u3_noun*  out)
+  {
+    c3_w     pos_w = dej_u->pos_w;
+    u3_noun  pro, val;
+    u3_noun* lit = &pro;
+    u3_noun* hed;
+    u3_noun* tel;
+
+    dej_u->pos_w++;
+
+    if ( c3y == fel_f(dej_u, &val) ) {
+      while ( 1 ) {
+        c3_w sav_w = dej_u->pos_w;
+
+        *lit = u3i_defcons(&hed, &tel);
+        *hed = val;
+        lit  = tel;
+
+        _json_de_spac(dej_u);
+
+        if ( ',' != _json_de_peek(dej_u) ) {
+          dej_u->pos_w = sav_w;
+          break;
+        }
+        dej_u->pos_w++;
+
+        if ( c3n == fel_f(dej_u, &val) ) {
+          dej_u->pos_w = sav_w;
+          break;
+        }
+      }
+    }
+    *lit = u3_nul;
+
+    _json_de_spac(dej_u);
+
+    if ( end_y != _json_de_peek(dej_u) ) {
+      u3z(pro);
+      dej_u->pos_w = pos_w;
+      return c3n;
+    }
+    dej_u->pos_w++;
+
+    *out = pro;
+    return c3y;
+  }
+
+  //  +apex: any value, with surrounding whitespace
+  //
+  static c3_o
+  _json_de_apex(_json_de* dej_u, u3_noun* out)
+  {
+    c3_w pos_w = dej_u->pos_w;
+    c3_o ret_o;
+
+    if ( JSON_DEEP <= dej_u->dep_w ) {
+      dej_u->pun_o = c3y;
+      return c3n;
+    }
+    dej_u->dep_w++;
+
+    _json_de_spac(dej_u);
+
+    switch ( _json_de_peek(dej_u) ) {
+      default: {
+        ret_o = c3n;
+      } break;
+
+      case 'n': {
+        if ( c3y == (ret_o = _json_de_jest(dej_u, "null")) ) {
+          *out = u3_nul;
+        }
+      } break;
+
+      case 't': {
+        if ( c3y == (ret_o = _json_de_jest(dej_u, "true")) ) {
+          *out = u3nc(c3__b, c3y);
+        }
+      } break;
+
+      case 'f': {
+        if ( c3y == (ret_o = _json_de_jest(dej_u, "false")) ) {
+          *out = u3nc(c3__b, c3n);
+        }
+      } break;
+
+      case '"': {
+        u3_noun str;
+
+        if ( c3y == (ret_o = _json_de_stri(dej_u, &str)) ) {
+          *out = u3nc(c3__s, str);
+        }
+      } break;
+
+      case '-':
+      case '0': case '1': case '2': case '3': case '4':
+      case '5': case '6': case '7': case '8': case '9': {
+        ret_o = _json_de_numb(dej_u, out);
+      } break;
+
+      case '[': {
+        u3_noun lis;
+
+        if ( c3y == (ret_o = _json_de_more(dej_u, ']', _json_de_apex, &lis)) ) {
+          *out = u3nc(c3__a, lis);
+        }
+      } break;
+
+      //  (malt obje): later duplicate keys win
+      //
+      case '{': {
+        u3_noun lis;
+
+        if ( c3y == (ret_o = _json_de_more(dej_u, '}', _json_de_pear, &lis)) ) {
+          u3_noun map = u3_nul;
+          u3_noun i, t = lis;
+
+          while ( u3_nul != t ) {
+            u3x_cell(t, &i, &t);
+            map = u3kdb_put(map, u3k(u3h(i)), u3k(u3t(i)));
+          }
+
+          u3z(lis);
+          *out = u3nc(c3__o, map);
+        }
+      } break;
+    }
+
+    dej_u->dep_w--;
+
+    if ( c3n == ret_o ) {
+      dej_u->pos_w = pos_w;
+      return c3n;
+    }
+
+    _json_de_spac(dej_u);
+    return c3y;
+  }
+
+  u3_noun
+  u3qe_de_json(u3_atom txt)
+  {
+    _json_de dej_u;
+    u3_noun  val;
+    u3_noun  pro;
+
+    dej_u.len_w = u3r_met(3, txt);
+    dej_u.pos_w = 0;
+    dej_u.dep_w = 0;
+    dej_u.pun_o = c3n;
+
+    //  +1 so that an empty cord needs no special case
+    //
+    dej_u.byt_y = u3a_malloc(dej_u.len_w + 1);
+    dej_u.tmp_y = u3a_malloc(dej_u.len_w + 1);
+    u3r_bytes(0, dej_u.len_w, dej_u.byt_y, txt);
+
+    if ( c3n == _json_de_apex(&dej_u, &val) ) {
+      pro = ( c3y == dej_u.pun_o ) ? u3_none : u3_nul;
+    }
+    else if ( dej_u.pos_w != dej_u.len_w ) {
+      u3z(val);
+      pro = u3_nul;
+    }
+    else {
+      pro = u3nc(u3_nul, val);
+    }
+
+    u3a_free(dej_u.byt_y);
+    u3a_free(dej_u.tmp_y);
+    return pro;
+  }
+
+  u3_noun
+  u3we_de_json(u3_noun cor)
+  {
+    return u3qe_de_json(u3x_atom(u3x_at(u3x_sam, cor)));
+  }
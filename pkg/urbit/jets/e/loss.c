@@ -14,6 +14,7 @@
     u3_noun sev;                            //  b as a set of lists
     c3_w kct_w;                             //  candidate count
     u3_noun* kad;                           //  candidate array
+    c3_w*    pen_w;                         //  pending [inx goy] pairs
   } u3_loss;
 
   //  free loss object
@@ -31,30 +32,26 @@
     }
     u3a_free(loc_u->hev);
     u3a_free(loc_u->kad);
+    u3a_free(loc_u->pen_w);
   }
 
-  //  extract lcs  -  XX don't use the stack like this
+  //  extract lcs: the candidate list is in reverse order
   //
   static u3_noun
-  _lext(u3_loss* loc_u,
-        u3_noun  kad)
+  _lexs(u3_loss* loc_u)
   {
-    if ( u3_nul == kad ) {
-      return u3_nul;
-    } else {
-      return u3nc(u3k(loc_u->hev[u3r_word(0, u3h(kad))]),
-                  _lext(loc_u, u3t(kad)));
+    u3_noun lcs = u3_nul;
+
+    if ( 0 != loc_u->kct_w ) {
+      u3_noun kad = loc_u->kad[loc_u->kct_w - 1];
+
+      while ( u3_nul != kad ) {
+        lcs = u3nc(u3k(loc_u->hev[u3r_word(0, u3h(kad))]), lcs);
+        kad = u3t(kad);
+      }
     }
-  }
 
-  //  extract lcs
-  //
-  static u3_noun
-  _lexs(u3_loss* loc_u)
-  {
-    if ( 0 == loc_u->kct_w ) {
-      return u3_nul;
-    } else return u3kb_flop(_lext(loc_u, loc_u->kad[loc_u->kct_w - 1]));
+    return lcs;
   }
 
   //  initialize loss object
@@ -82,6 +79,7 @@
     loc_u->kct_w = 0;
     loc_u->kad = u3a_malloc((1 + c3_min(loc_u->lev_w, loc_u->lel_w)) *
                              sizeof(u3_noun));
+    loc_u->pen_w = u3a_malloc((1 + loc_u->lev_w) * 2 * sizeof(c3_w));
 
     //  Compute equivalence classes.
     //
@@ -182,55 +180,57 @@
   {
     c3_assert(max_w >= *inx_w);
 
-    if ( max_w == *inx_w ) {
-      if ( c3n == _lonk(loc_u, *inx_w, goy_w) ) {
-        return c3n;
-      }
-      if ( c3y == _hink(loc_u, *inx_w, goy_w) ) {
-        return c3y;
-      }
-      else {
-        ++*inx_w;
-        return c3n;
-      }
-    }
-    else {
+    while ( max_w != *inx_w ) {
       c3_w mid_w = *inx_w + ((max_w - *inx_w) / 2);
 
       if ( (c3n == _lonk(loc_u, mid_w, goy_w)) ||
            (c3y == _hink(loc_u, mid_w, goy_w)) )
       {
-        return _bink(loc_u, inx_w, mid_w, goy_w);
+        max_w = mid_w;
       } else {
         *inx_w = mid_w + 1;
-        return _bink(loc_u, inx_w, max_w, goy_w);
       }
     }
-  }
 
+    if ( c3n == _lonk(loc_u, *inx_w, goy_w) ) {
+      return c3n;
+    }
+    if ( c3y == _hink(loc_u, *inx_w, goy_w) ) {
+      return c3y;
+    }
+    else {
+      ++*inx_w;
+      return c3n;
+    }
+  }
 
+  //  merge the matches [gay], ascending, into the candidates.
+  //  each match is placed against the candidates as they were
+  //  before any of them, so the updates are applied afterwards,
+  //  highest index first.
+  //
   static void
   _merg(u3_loss* loc_u,
         c3_w     inx_w,
         u3_noun  gay)
   {
-    if ( (u3_nul == gay) || (inx_w > loc_u->kct_w) ) {
-      return;
-    }
-    else {
-      u3_noun i_gay = u3h(gay);
-      c3_w    goy_w = u3r_word(0, i_gay);
-      u3_noun bik;
+    c3_w pen_w = 0;
 
-      bik = _bink(loc_u, &inx_w, loc_u->kct_w, goy_w);
+    while ( (u3_nul != gay) && (inx_w <= loc_u->kct_w) ) {
+      c3_w goy_w = u3r_word(0, u3h(gay));
 
-      if ( c3y == bik ) {
-        _merg(loc_u, inx_w + 1, u3t(gay));
-        _lune(loc_u, inx_w, goy_w);
-      }
-      else {
-        _merg(loc_u, inx_w, u3t(gay));
+      if ( c3y == _bink(loc_u, &inx_w, loc_u->kct_w, goy_w) ) {
+        loc_u->pen_w[pen_w++] = inx_w;
+        loc_u->pen_w[pen_w++] = goy_w;
+        inx_w++;
       }
+
+      gay = u3t(gay);
+    }
+
+    while ( pen_w ) {
+      pen_w -= 2;
+      _lune(loc_u, loc_u->pen_w[pen_w], loc_u->pen_w[pen_w + 1]);
     }
   }
 
@@ -258,12 +258,29 @@
   u3qe_loss(u3_noun hel,
             u3_noun hev)
   {
-    u3_loss loc_u;
-    u3_noun lcs;
+    u3_loss  loc_u;
+    u3_noun  lcs;
+    u3_noun* lit = &lcs;
+    u3_noun* hed;
+    u3_noun* tel;
+
+    //  a common prefix heads every candidate, so it is matched
+    //  here and the rest solved alone
+    //
+    while (  (u3_nul != hel)
+          && (u3_nul != hev)
+          && (c3y == u3r_sing(u3h(hel), u3h(hev))) )
+    {
+      *lit = u3i_defcons(&hed, &tel);
+      *hed = u3k(u3h(hel));
+      lit  = tel;
+      hel  = u3t(hel);
+      hev  = u3t(hev);
+    }
 
     _lemp(&loc_u, hel, hev);
     _loss(&loc_u);
-    lcs = _lexs(&loc_u);
+    *lit = _lexs(&loc_u);
 
     _flem(&loc_u);
     return lcs;
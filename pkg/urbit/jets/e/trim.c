@@ -0,0 +1,47 @@
+/* j/5/trim.c
+**
+*/
+#include "all.h"
+
+u3_noun
+u3qe_trim(u3_atom a,
+          u3_noun b)
+{
+  u3_noun  pro;
+  u3_noun* hed;
+  u3_noun* tel;
+  u3_noun* lit = &pro;
+  //  an indirect count is longer than any list
+  //
+  c3_w   len_w = ( c3y == u3a_is_cat(a) ) ? a : 0xffffffff;
+
+  while ( len_w && (u3_nul != b) ) {
+    if ( c3n == u3du(b) ) {
+      return u3m_bail(c3__exit);
+    }
+
+    *lit = u3i_defcons(&hed, &tel);
+    *hed = u3k(u3h(b));
+    lit  = tel;
+    b    = u3t(b);
+    len_w--;
+  }
+
+  *lit = u3_nul;
+
+  return u3nc(pro, u3k(b));
+}
+
+u3_noun
+u3we_trim(u3_noun cor)
+{
+  u3_noun a, b;
+
+  if ( (c3n == u3r_mean(cor, u3x_sam_2, &a, u3x_sam_3, &b, 0)) ||
+       (c3n == u3ud(a)) )
+  {
+    return u3m_bail(c3__exit);
+  }
+
+  return u3qe_trim(a, b);
+}
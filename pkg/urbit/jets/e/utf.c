@@ -0,0 +1,194 @@
+/* j/5/utf.c
+**
+*/
+#include "all.h"
+
+
+/* functions
+*/
+  //  +tuft on one 32-bit character; produces the byte count.
+  //  as in the hoon, a zero character has no bytes, and only
+  //  the low 21 bits of a character are encoded
+  //
+  static c3_y
+  _utf_tuft(c3_w b_w, c3_y* byt_y)
+  {
+    if ( 0 == b_w ) {
+      return 0;
+    }
+    else if ( b_w <= 0x7f ) {
+      byt_y[0] = b_w;
+      return 1;
+    }
+    else if ( b_w <= 0x7ff ) {
+      byt_y[0] = 0xc0 | ((b_w >> 6) & 0x1f);
+      byt_y[1] = 0x80 | (b_w & 0x3f);
+      return 2;
+    }
+    else if ( b_w <= 0xffff ) {
+      byt_y[0] = 0xe0 | ((b_w >> 12) & 0xf);
+      byt_y[1] = 0x80 | ((b_w >> 6) & 0x3f);
+      byt_y[2] = 0x80 | (b_w & 0x3f);
+      return 3;
+    }
+    else {
+      byt_y[0] = 0xf0 | ((b_w >> 18) & 0x7);
+      byt_y[1] = 0x80 | ((b_w >> 12) & 0x3f);
+      byt_y[2] = 0x80 | ((b_w >> 6) & 0x3f);
+      byt_y[3] = 0x80 | (b_w & 0x3f);
+      return 4;
+    }
+  }
+
+  //  one step of +taft at byt_y, which has at least four readable
+  //  bytes (zero past the end of the text); produces the byte count
+  //  and sets *c_w, or produces 0 where +teff or +taft would crash
+  //
+  static c3_y
+  _utf_taft(c3_y* byt_y, c3_w* c_w)
+  {
+    c3_y b_y = byt_y[0];
+    c3_y len_y, i_y;
+    c3_y tuf_y[4];
+
+    if ( (b_y < 32) && (10 != b_y) ) {
+      return 0;
+    }
+
+    if ( b_y <= 127 ) {
+      len_y = 1;
+      *c_w  = b_y & 0x7f;
+    }
+    else if ( b_y <= 223 ) {
+      len_y = 2;
+      *c_w  = (byt_y[1] & 0x3f)
+            | ((c3_w)(b_y & 0x1f) << 6);
+    }
+    else if ( b_y <= 239 ) {
+      len_y = 3;
+      *c_w  = (byt_y[2] & 0x3f)
+            | ((c3_w)(byt_y[1] & 0x3f) << 6)
+            | ((c3_w)(b_y & 0xf) << 12);
+    }
+    else {
+      len_y = 4;
+      *c_w  = (byt_y[3] & 0x3f)
+            | ((c3_w)(byt_y[2] & 0x3f) << 6)
+            | ((c3_w)(byt_y[1] & 0x3f) << 12)
+            | ((c3_w)(b_y & 0x7) << 18);
+    }
+
+    //  the character must re-encode to exactly the bytes read,
+    //  which rejects overlong forms and bad continuations
+    //
+    if ( len_y != _utf_tuft(*c_w, tuf_y) ) {
+      return 0;
+    }
+    for ( i_y = 0; i_y < len_y; i_y++ ) {
+      if ( tuf_y[i_y] != byt_y[i_y] ) {
+        return 0;
+      }
+    }
+
+    return len_y;
+  }
+
+  u3_noun
+  u3qe_tuba(u3_noun a)
+  {
+    u3_atom  tex = u3qc_rap(3, a);
+    c3_w   len_w = u3r_met(3, tex);
+    c3_w     i_w = 0,
+             n_w = 0;
+    c3_y*  byt_y;
+    c3_w*  chr_w;
+    u3_noun  pro = u3_nul;
+
+    if ( 0 == len_w ) {
+      return u3_nul;
+    }
+
+    //  four bytes of zero padding stand for the top of the atom
+    //
+    byt_y = u3a_malloc(len_w + 4);
+    chr_w = u3a_malloc(len_w * sizeof(c3_w));
+    memset(byt_y + len_w, 0, 4);
+    u3r_bytes(0, len_w, byt_y, tex);
+    u3z(tex);
+
+    while ( i_w < len_w ) {
+      c3_y len_y;
+
+      //  a zero byte here is inside the text, which +teff rejects
+      //
+      if ( (0 == byt_y[i_w]) ||
+           (0 == (len_y = _utf_taft(byt_y + i_w, &chr_w[n_w]))) )
+      {
+        u3a_free(chr_w);
+        u3a_free(byt_y);
+        return u3m_bail(c3__exit);
+      }
+
+      i_w += len_y;
+      n_w++;
+    }
+
+    while ( n_w ) {
+      n_w--;
+      pro = u3nc(chr_w[n_w], pro);
+    }
+
+    u3a_free(chr_w);
+    u3a_free(byt_y);
+    return pro;
+  }
+  u3_noun
+  u3we_tuba(u3_noun cor)
+  {
+    return u3qe_tuba(u3x_at(u3x_sam, cor));
+  }
+
+  u3_noun
+  u3qe_tufa(u3_noun a)
+  {
+    u3_noun  pro;
+    u3_noun* hed;
+    u3_noun* tel;
+    u3_noun* lit = &pro;
+    u3_noun    t = a;
+
+    while ( u3_nul != t ) {
+      if ( (c3n == u3du(t)) || (c3n == u3ud(u3h(t))) ) {
+        return u3m_bail(c3__exit);
+      }
+      t = u3t(t);
+    }
+
+    for ( t = a; u3_nul != t; t = u3t(t) ) {
+      u3_atom i = u3h(t);
+      c3_w    len_w = u3r_met(5, i),
+              j_w;
+
+      //  each 32-bit character of the atom, low first
+      //
+      for ( j_w = 0; j_w < len_w; j_w++ ) {
+        c3_y tuf_y[4];
+        c3_y k_y, len_y = _utf_tuft(u3r_word(j_w, i), tuf_y);
+
+        for ( k_y = 0; k_y < len_y; k_y++ ) {
+          *lit = u3i_defcons(&hed, &tel);
+          *hed = tuf_y[k_y];
+          lit  = tel;
+        }
+      }
+    }
+
+    *lit = u3_nul;
+
+    return pro;
+  }
+  u3_noun
+  u3we_tufa(u3_noun cor)
+  {
+    return u3qe_tufa(u3x_at(u3x_sam, cor));
+  }
@@ -15,6 +15,9 @@
 
 #include "all.h"
 
+//  for cores registered without battery hashes; they bind by label,
+//  and on first use the hot-jet log prints the hash to pin them with
+//
 static c3_c* no_hashes[] = { 0 };
 
 static u3j_harm _140_hex_mimes_base16_en_a[] = {{".2", u3we_en_base16}, {}};
@@ -39,8 +42,18 @@ static c3_c* _140_hex_mimes_base16_ha[] = {
   0
 };
 
+static u3j_harm _140_hex_mimes_base64_en_a[] = {{".2", u3we_en_base64}, {}};
+static u3j_harm _140_hex_mimes_base64_de_a[] = {{".2", u3we_de_base64}, {}};
+
+static u3j_core _140_hex_mimes_base64_d[] =
+  { { "en", 31, _140_hex_mimes_base64_en_a, 0, no_hashes },
+    { "de",  7, _140_hex_mimes_base64_de_a, 0, no_hashes },
+    {}
+  };
+
 static u3j_core _140_hex_mimes_d[] =
   { { "base16", 3, 0, _140_hex_mimes_base16_d, _140_hex_mimes_base16_ha },
+    { "base64", 15, 0, _140_hex_mimes_base64_d, no_hashes },
     {}
   };
 static c3_c* _140_hex_mimes_ha[] = {
@@ -48,6 +61,9 @@ static c3_c* _140_hex_mimes_ha[] = {
   0
 };
 
+static u3j_harm _140_hex_json_en_a[] = {{".2", u3we_en_json}, {}};
+static u3j_harm _140_hex_json_de_a[] = {{".2", u3we_de_json}, {}};
+
 static u3j_harm _140_hex_aes_ecba_en_a[] = {{".2", u3wea_ecba_en}, {}};
 static c3_c* _140_hex_aes_ecba_en_ha[] = {
   "d7674ad72666a787580c52785c5d4d37ca462ba05e904efbeded5d1bd8b02b4b",
@@ -510,6 +526,8 @@ static u3j_core _140_hex_d[] =
   { "scr",    31, 0, _140_hex_scr_d,   _140_hex_scr_ha   },
   { "secp",    6, 0, _140_hex_secp_d,  _140_hex_secp_ha },
   { "mimes",  31, 0, _140_hex_mimes_d, _140_hex_mimes_ha  },
+  { "en-json", 127, _140_hex_json_en_a, 0, no_hashes },
+  { "de-json", 127, _140_hex_json_de_a, 0, no_hashes },
   {}
 };
 static c3_c* _140_hex_ha[] = {
@@ -761,6 +779,12 @@ static c3_c* _140_qua_trip_ha[] = {
   "05423b940d10d03891cc23f36eea14b233e5884ef539de3d985d6818dd427b05",
   0
 };
+static u3j_harm _140_qua_cass_a[] = {{".2", u3we_cass}, {}};
+static u3j_harm _140_qua_cuss_a[] = {{".2", u3we_cuss}, {}};
+static u3j_harm _140_qua_crip_a[] = {{".2", u3we_crip}, {}};
+static u3j_harm _140_qua_trim_a[] = {{".2", u3we_trim}, {}};
+static u3j_harm _140_qua_tuba_a[] = {{".2", u3we_tuba}, {}};
+static u3j_harm _140_qua_tufa_a[] = {{".2", u3we_tufa}, {}};
 
 static u3j_harm _140_qua_slaw_a[] = {{".2", u3we_slaw}, {}};
 static c3_c* _140_qua_slaw_ha[] = {
@@ -1035,6 +1059,12 @@ static u3j_core _140_qua_d[] =
   { "po", 7, 0, _140_qua__po_d, _140_qua__po_ha },
 
   { "trip", 7, _140_qua_trip_a, 0, _140_qua_trip_ha },
+  { "cass", 7, _140_qua_cass_a, 0, no_hashes },
+  { "cuss", 7, _140_qua_cuss_a, 0, no_hashes },
+  { "crip", 7, _140_qua_crip_a, 0, no_hashes },
+  { "trim", 7, _140_qua_trim_a, 0, no_hashes },
+  { "tuba", 7, _140_qua_tuba_a, 0, no_hashes },
+  { "tufa", 7, _140_qua_tufa_a, 0, no_hashes },
 
   { "bend", 7, 0, _140_qua__bend_d, _140_qua__bend_ha },
   { "cold", 7, 0, _140_qua__cold_d, _140_qua__cold_ha },
@@ -1750,6 +1780,7 @@ static c3_c* _140_two_xeb_ha[] = {
     "a488f0be5adbb1c04e2038a2315ac065591e7daadcafc1d47aea272979680468",
     0
   };
+  static u3j_harm _140_two__in_dig_a[] = {{".2", u3wdi_dig}, {}};
   static u3j_harm _140_two__in_gas_a[] = {{".2", u3wdi_gas}, {}};
   static c3_c* _140_two__in_gas_ha[] = {
     "223a60a43a10f1f90a3b205ecfce8e17af1adfcf9dbf3cff9b8b1362656b1af1",
@@ -1803,6 +1834,7 @@ static u3j_core _140_two__in_d[] =
     { "bif", 7, _140_two__in_bif_a, 0, _140_two__in_bif_ha },
     { "del", 7, _140_two__in_del_a, 0, _140_two__in_del_ha },
     { "dif", 7, _140_two__in_dif_a, 0, _140_two__in_dif_ha },
+    { "dig", 7, _140_two__in_dig_a, 0, no_hashes },
     { "gas", 7, _140_two__in_gas_a, 0, _140_two__in_gas_ha },
     { "has", 7, _140_two__in_has_a, 0, _140_two__in_has_ha },
     { "int", 7, _140_two__in_int_a, 0, _140_two__in_int_ha },
@@ -1848,6 +1880,7 @@ static c3_c* _140_two__in_ha[] = {
     "0334e6df6fd0bd5013b94a1b22c29e4c436da0a2d5573f1992faad1c8a059cc7",
     0
   };
+  static u3j_harm _140_two__by_dig_a[] = {{".2", u3wdb_dig}, {}};
   static u3j_harm _140_two__by_gas_a[] = {{".2", u3wdb_gas, c3y}, {}};
   static c3_c* _140_two__by_gas_ha[] = {
     "43046602e0b9e568b09448cfe18527e2331f3393a2f32e485d9707a14c346698",
@@ -1890,6 +1923,7 @@ static c3_c* _140_two__in_ha[] = {
     "05bfb84a52ed8ccc330a96faca29a49afd28300960ac089d00dba32212b971a7",
     0
   };
+  static u3j_harm _140_two__by_rib_a[] = {{".2", u3wdb_rib}, {}};
   static u3j_harm _140_two__by_run_a[] = {{".2", u3wdb_run, c3y}, {}};
   static c3_c* _140_two__by_run_ha[] = {
     "adea01e9036e0b40e4969814d4eed935d7d69a52e4a55de5520df2fa5204d8e7",
@@ -1923,6 +1957,7 @@ static u3j_core _140_two__by_d[] =
     { "bif", 7, _140_two__by_bif_a, 0, _140_two__by_bif_ha },
     { "del", 7, _140_two__by_del_a, 0, _140_two__by_del_ha },
     { "dif", 7, _140_two__by_dif_a, 0, _140_two__by_dif_ha },
+    { "dig", 7, _140_two__by_dig_a, 0, no_hashes },
     { "gas", 7, _140_two__by_gas_a, 0, _140_two__by_gas_ha },
     { "get", 7, _140_two__by_get_a, 0, _140_two__by_get_ha },
     { "has", 7, _140_two__by_has_a, 0, _140_two__by_has_ha },
@@ -1931,6 +1966,7 @@ static u3j_core _140_two__by_d[] =
     { "key", 7, _140_two__by_key_a, 0, _140_two__by_key_ha },
     { "put", 7, _140_two__by_put_a, 0, _140_two__by_put_ha },
     { "rep", 7, _140_two__by_rep_a, 0, _140_two__by_rep_ha },
+    { "rib", 7, _140_two__by_rib_a, 0, no_hashes },
     { "run", 7, _140_two__by_run_a, 0, _140_two__by_run_ha },
     { "tap", 7, _140_two__by_tap_a, 0, _140_two__by_tap_ha },
     { "uni", 7, _140_two__by_uni_a, 0, _140_two__by_uni_ha },
@@ -1731,6 +1731,20 @@ u3a_rewritten_noun(u3_noun som)
   }
 }
 
+/* u3a_rewritten_mptr(): rewrite a u3a_malloc() pointer for compaction.
+**
+**   the alignment padding moves with the box, so the new pointer
+**   keeps its offset from the start of the allocation.
+*/
+u3_post
+u3a_rewritten_mptr(u3_post ptr_p)
+{
+  c3_w* ptr_w = u3a_into(ptr_p);
+  c3_w  pad_w = ptr_w[-1];
+
+  return u3a_rewritten(ptr_p - (pad_w + 1)) + (pad_w + 1);
+}
+
 /* u3a_mark_mptr(): mark a malloc-allocated ptr for gc.
 */
 c3_w
@@ -2517,6 +2531,17 @@ u3a_rewrite_ptr(void* ptr_v)
   return c3y;
 }
 
+/* u3a_rewrite_mptr(): mark a u3a_malloc() pointer as rewritten.
+*/
+c3_o
+u3a_rewrite_mptr(void* ptr_v)
+{
+  c3_w* ptr_w = ptr_v;
+  c3_w  pad_w = ptr_w[-1];
+
+  return u3a_rewrite_ptr(ptr_w - (pad_w + 1));
+}
+
 void
 u3a_rewrite_noun(u3_noun som)
 {
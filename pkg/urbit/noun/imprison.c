@@ -247,6 +247,44 @@ u3i_slab_mint(u3i_slab* sab_u)
   return pro;
 }
 
+/* u3i_slab_limbs(): configure slab for [len_d] GMP limbs,
+**                   uninitialized; produce where to write them.
+*/
+mp_limb_t*
+u3i_slab_limbs(u3i_slab* sab_u, c3_d len_d)
+{
+  c3_w* lim_w;
+
+  //  one spare word, so the limbs can start on a limb boundary;
+  //  at least one limb, so the slab is always on the heap
+  //
+  u3i_slab_bare(sab_u, 5, (c3_max(len_d, 1) * c3_wiseof(mp_limb_t)) + 1);
+  lim_w = sab_u->buf_w;
+
+  if ( (c3_p)lim_w % sizeof(mp_limb_t) ) {
+    lim_w++;
+  }
+
+  return (mp_limb_t*)lim_w;
+}
+
+/* u3i_slab_mint_limbs(): produce atom from limb-slab, trimming.
+*/
+u3_atom
+u3i_slab_mint_limbs(u3i_slab* sab_u)
+{
+  c3_w len_w = sab_u->len_w - 1;
+
+  //  limbs written past the spare word are moved down onto it
+  //
+  if ( (c3_p)sab_u->buf_w % sizeof(mp_limb_t) ) {
+    memmove(sab_u->buf_w, sab_u->buf_w + 1, len_w * sizeof(c3_w));
+  }
+  sab_u->buf_w[len_w] = 0;
+
+  return u3i_slab_mint(sab_u);
+}
+
 /* u3i_slab_moot(): produce atom from slab, no trimming.
 */
 u3_atom
@@ -3,6 +3,7 @@
 */
 #include "all.h"
 #include <urcrypt.h>
+#include <time.h>
 
 /**  Data structures.
 **/
@@ -642,6 +643,7 @@ _cj_spot(u3_noun cor, u3_weak* bas)
       if ( u3_none != act ) {
         reg = _cj_gust(reg, _cj_loc_axe(loc), _cj_loc_pel(loc), u3k(loc));
         u3h_put(u3R->jed.cod_p, u3h(cor), u3nc(u3k(*bas), u3k(reg)));
+        u3D.epo_w++;
         /* caution: could overwrites old value, debug batteries etc.
         **          old value contains old _cj_jit (from different
         **          battery). if we change jit to (map battery *),
@@ -811,6 +813,7 @@ u3j_boot(c3_o nuu_o)
     u3h_free(u3R->jed.hot_p);
   }
   u3R->jed.hot_p = u3h_new();
+  u3D.epo_w++;
 
   return _cj_install(u3D.ray_u, 1,
                      (c3_l) (long long) u3D.dev_u[0].par_u,
@@ -833,6 +836,43 @@ _cj_soft(u3_noun cor, u3_noun axe)
              u3_noun old,
              u3_noun new);
 
+/* _cj_time(): monotonic nanoseconds.
+*/
+static c3_d
+_cj_time(void)
+{
+  struct timespec tim_u;
+
+  clock_gettime(CLOCK_MONOTONIC, &tim_u);
+  return (c3_d)tim_u.tv_sec * 1000000000ULL + (c3_d)tim_u.tv_nsec;
+}
+
+/* _cj_harm_call(): run a jet arm, counting calls and punts, and timing
+**                  it when profiling. jets that bail are not timed.
+*/
+static u3_weak
+_cj_harm_call(u3j_harm* ham_u, u3_noun cor)
+{
+  u3_weak pro;
+
+  ham_u->cal_d++;
+
+  if ( u3C.wag_w & u3o_debug_cpu ) {
+    c3_d now_d = _cj_time();
+
+    pro = ham_u->fun_f(cor);
+    ham_u->tim_d += _cj_time() - now_d;
+  }
+  else {
+    pro = ham_u->fun_f(cor);
+  }
+
+  if ( u3_none == pro ) {
+    ham_u->pun_d++;
+  }
+  return pro;
+}
+
 /* _cj_kick_z(): try to kick by jet.  If no kick, produce u3_none.
 **
 ** `cor` is RETAINED iff there is no kick, TRANSFERRED if one.
@@ -864,7 +904,7 @@ _cj_kick_z(u3_noun cor, u3j_core* cop_u, u3j_harm* ham_u, u3_atom axe)
 #endif
 
     if ( _(ham_u->ice) ) {
-      u3_weak pro = ham_u->fun_f(cor);
+      u3_weak pro = _cj_harm_call(ham_u, cor);
 
 #ifdef U3_MEMORY_DEBUG
       u3a_lop(cod_w);
@@ -878,7 +918,7 @@ _cj_kick_z(u3_noun cor, u3j_core* cop_u, u3j_harm* ham_u, u3_atom axe)
       u3_weak pro, ame;
 
       ham_u->ice = c3y;
-      pro = ham_u->fun_f(cor);
+      pro = _cj_harm_call(ham_u, cor);
       ham_u->ice = c3n;
 
 #ifdef U3_MEMORY_DEBUG
@@ -898,6 +938,7 @@ _cj_kick_z(u3_noun cor, u3j_core* cop_u, u3j_harm* ham_u, u3_atom axe)
                (!strcmp(".2", ham_u->fcs_c)) ? "$" : ham_u->fcs_c,
                u3r_mug(ame),
                u3r_mug(pro));
+        ham_u->mis_d++;
         ham_u->liv = c3n;
 
         return u3m_bail(c3__fail);
@@ -1110,9 +1151,9 @@ _cj_hank_fine(_cj_hank* han_u, u3_noun cor, u3_noun *inn)
       return c3n;
     }
     else {
-      u3j_site* sit_u = &(han_u->sit_u);
-      c3_assert(u3_none != sit_u->loc);
-      return _cj_fine(*inn, sit_u->fin_p);
+      u3j_line* lin_u = &(han_u->sit_u.lin_u[0]);
+      c3_assert(u3_none != lin_u->loc);
+      return _cj_fine(*inn, lin_u->fin_p);
     }
   }
 }
@@ -1137,13 +1178,13 @@ _cj_hank_fill(_cj_hank* han_u, u3_noun tam, u3_noun cor)
   u3_noun   got, pat, nam, huc;
   u3_noun   hax = 1;
   u3j_site* sit_u = &(han_u->sit_u);
+  u3j_line* lin_u = &(sit_u->lin_u[0]);
 
   if ( c3n == u3du(cor) ) {
     u3l_log("fail in _cj_hank_fill (c3n == u3du(cor))");
     return u3m_bail(c3__fail);
   }
 
-  sit_u->bas = u3_none;
   if ( u3_none == (col = loc = _cj_spot(cor, NULL)) ) {
     u3l_log("fail in _cj_hank_fill (_cj_spot(cor, NULL))");
     return u3m_bail(c3__fail);
@@ -1155,19 +1196,20 @@ _cj_hank_fill(_cj_hank* han_u, u3_noun tam, u3_noun cor)
     if ( u3_nul != got ) {
       u3_noun fol = u3k(u3t(got));
       u3z(got);
-      sit_u->bat   = u3k(u3h(cor));
-      sit_u->loc   = u3k(loc);
-      sit_u->fin_p = _cj_cast(cor, loc);
-      sit_u->fon_o = c3y;
-      if ( 0 == (sit_u->axe = _cj_axis(fol)) ) {
-        sit_u->jet_o = c3n;
-        sit_u->pog_p = _cj_prog(loc, fol);
+      u3j_site_init(sit_u, _cj_axis(fol));
+      lin_u->bat   = u3k(u3h(cor));
+      lin_u->loc   = u3k(loc);
+      lin_u->fin_p = _cj_cast(cor, loc);
+      lin_u->fon_o = c3y;
+      lin_u->jet_o = _cj_nail(loc, sit_u->axe,
+          &(lin_u->lab), &(lin_u->cop_u), &(lin_u->ham_u));
+      if ( 0 == sit_u->axe ) {
+        lin_u->jet_o = c3n;
+        lin_u->pog_p = _cj_prog(loc, fol);
       }
       else {
         // loc already known-valid
-        han_u->sit_u.pog_p = _cj_prog(loc, u3r_at(sit_u->axe, cor));
-        han_u->sit_u.jet_o = _cj_nail(loc, sit_u->axe,
-            &(sit_u->lab), &(sit_u->cop_u), &(sit_u->ham_u));
+        lin_u->pog_p = _cj_prog(loc, u3r_at(sit_u->axe, cor));
       }
       u3z(fol);
       u3z(col);
@@ -1393,39 +1435,112 @@ u3j_rite_merge(u3j_rite* dst_u, u3j_rite* src_u)
   }
 }
 
+/* _cj_line_init(): empty a u3j_line.
+*/
+static void
+_cj_line_init(u3j_line* lin_u)
+{
+  lin_u->pog_p = 0;
+  lin_u->bat   = u3_none;
+  lin_u->bas   = u3_none;
+  lin_u->loc   = u3_none;
+  lin_u->lab   = u3_none;
+  lin_u->jet_o = c3n;
+  lin_u->fon_o = c3n;
+  lin_u->cop_u = NULL;
+  lin_u->ham_u = NULL;
+  lin_u->fin_p = 0;
+  lin_u->epo_w = 0;
+}
+
+/* _cj_line_lose(): lose references of u3j_line (but do not free).
+*/
+static void
+_cj_line_lose(u3j_line* lin_u)
+{
+  if ( u3_none != lin_u->bat ) {
+    u3z(lin_u->bat);
+  }
+  if ( u3_none != lin_u->bas ) {
+    u3z(lin_u->bas);
+  }
+  if ( u3_none != lin_u->loc ) {
+    u3z(lin_u->loc);
+    u3z(lin_u->lab);
+    if ( c3y == lin_u->fon_o ) {
+      _cj_fink_free(lin_u->fin_p);
+    }
+  }
+}
+
+/* _cj_line_take(): copy junior line references. [dst_u] is uninitialized.
+**                  produces no if the line was not worth keeping.
+*/
+static c3_o
+_cj_line_take(u3j_line* dst_u, u3j_line* src_u)
+{
+  //  unlocated lines are only good for the epoch they were made in
+  //
+  if ( (u3_none == src_u->bat) || (u3_none == src_u->loc) ) {
+    return c3n;
+  }
+
+  dst_u->pog_p = 0;
+  dst_u->bat   = u3a_take(src_u->bat);
+  dst_u->bas   = ( u3_none == src_u->bas ) ? u3_none : u3a_take(src_u->bas);
+  dst_u->loc   = u3a_take(src_u->loc);
+  dst_u->lab   = u3a_take(src_u->lab);
+  dst_u->jet_o = src_u->jet_o;
+  dst_u->cop_u = src_u->cop_u;
+  dst_u->ham_u = src_u->ham_u;
+  dst_u->epo_w = 0;
+
+  if ( c3y == src_u->fon_o ) {
+    dst_u->fin_p = u3of(u3j_fink, _cj_fink_take(u3to(u3j_fink, src_u->fin_p)));
+    dst_u->fon_o = c3y;
+  }
+  else {
+    dst_u->fin_p = src_u->fin_p;
+    dst_u->fon_o = c3n;
+  }
+
+  return c3y;
+}
+
+/* u3j_site_init(): initialize an empty u3j_site. axe is TRANSFERRED.
+*/
+void
+u3j_site_init(u3j_site* sit_u, u3_noun axe)
+{
+  c3_w i_w;
+
+  sit_u->pog_p = 0;
+  sit_u->axe   = axe;
+  sit_u->hit_w = 0;
+  sit_u->mis_w = 0;
+
+  for ( i_w = 0; i_w < u3j_site_ways; i_w++ ) {
+    _cj_line_init(&(sit_u->lin_u[i_w]));
+  }
+}
+
 /* u3j_site_take(): copy junior site references. [dst_u] is uninitialized
 */
 void
 u3j_site_take(u3j_site* dst_u, u3j_site* src_u)
 {
-  dst_u->axe   = u3a_take(src_u->axe);
-  dst_u->bat   = u3_none;
-  dst_u->bas   = u3_none;
-  dst_u->pog_p = 0;
+  c3_w i_w, j_w;
 
-  if ( u3_none == src_u->loc ) {
-    dst_u->loc   = u3_none;
-    dst_u->lab   = u3_none;
-    dst_u->jet_o = c3n;
-    dst_u->cop_u = NULL;
-    dst_u->ham_u = NULL;
-    dst_u->fin_p = 0;
-    dst_u->fon_o = c3n;
-  }
-  else {
-    dst_u->loc   = u3a_take(src_u->loc);
-    dst_u->lab   = u3a_take(src_u->lab);
-    dst_u->jet_o = src_u->jet_o;
-    dst_u->cop_u = src_u->cop_u;
-    dst_u->ham_u = src_u->ham_u;
+  u3j_site_init(dst_u, u3a_take(src_u->axe));
+  dst_u->hit_w = src_u->hit_w;
+  dst_u->mis_w = src_u->mis_w;
 
-    if ( c3y == src_u->fon_o ) {
-      dst_u->fin_p = u3of(u3j_fink, _cj_fink_take(u3to(u3j_fink, src_u->fin_p)));
-      dst_u->fon_o = c3y;
+  for ( i_w = j_w = 0; i_w < u3j_site_ways; i_w++ ) {
+    if ( c3y == _cj_line_take(&(dst_u->lin_u[j_w]), &(src_u->lin_u[i_w])) ) {
+      j_w++;
     }
     else {
-      dst_u->fin_p = src_u->fin_p;
-      dst_u->fon_o = c3n;
+      _cj_line_init(&(dst_u->lin_u[j_w]));
     }
   }
 }
@@ -1436,26 +1551,36 @@ u3j_site_take(u3j_site* dst_u, u3j_site* src_u)
 void
 u3j_site_merge(u3j_site* dst_u, u3j_site* src_u)
 {
+  c3_w i_w, j_w;
+
   u3z(dst_u->axe);
-  dst_u->axe = src_u->axe;
+  dst_u->axe   = src_u->axe;
+  dst_u->pog_p = 0;
+  dst_u->hit_w = src_u->hit_w;
+  dst_u->mis_w = src_u->mis_w;
 
-  if ( u3_none != src_u->loc ) {
-    u3z(dst_u->loc);
-    u3z(dst_u->lab);
-    dst_u->loc   = src_u->loc;
-    dst_u->lab   = src_u->lab;
-    dst_u->cop_u = src_u->cop_u;
-    dst_u->ham_u = src_u->ham_u;
-    dst_u->jet_o = src_u->jet_o;
+  for ( i_w = 0; i_w < u3j_site_ways; i_w++ ) {
+    u3j_line* lin_u = &(dst_u->lin_u[i_w]);
 
-    if ( dst_u->fin_p != src_u->fin_p ) {
-      if ( c3y == dst_u->fon_o )  {
-        _cj_fink_free(dst_u->fin_p);
-      }
+    //  a taken line may still share our fink; if so, hand it over
+    //
+    if ( (u3_none != lin_u->loc) && (c3y == lin_u->fon_o) ) {
+      for ( j_w = 0; j_w < u3j_site_ways; j_w++ ) {
+        u3j_line* nil_u = &(src_u->lin_u[j_w]);
 
-      dst_u->fin_p = src_u->fin_p;
-      dst_u->fon_o = src_u->fon_o;
+        if ( (u3_none != nil_u->loc)
+          && (c3n == nil_u->fon_o)
+          && (lin_u->fin_p == nil_u->fin_p) )
+        {
+          nil_u->fon_o = c3y;
+          lin_u->fon_o = c3n;
+          break;
+        }
+      }
     }
+
+    _cj_line_lose(lin_u);
+    *lin_u = src_u->lin_u[i_w];
   }
 }
 
@@ -1464,27 +1589,42 @@ u3j_site_merge(u3j_site* dst_u, u3j_site* src_u)
 void
 u3j_site_ream(u3j_site* sit_u)
 {
-  if ( u3_none != sit_u->loc ) {
-    u3z(sit_u->lab);
-    sit_u->jet_o = _cj_nail(sit_u->loc, sit_u->axe,
-        &(sit_u->lab), &(sit_u->cop_u), &(sit_u->ham_u));
+  c3_w i_w;
+
+  for ( i_w = 0; i_w < u3j_site_ways; i_w++ ) {
+    u3j_line* lin_u = &(sit_u->lin_u[i_w]);
+
+    if ( u3_none != lin_u->loc ) {
+      u3z(lin_u->lab);
+      lin_u->jet_o = _cj_nail(lin_u->loc, sit_u->axe,
+          &(lin_u->lab), &(lin_u->cop_u), &(lin_u->ham_u));
+    }
+    else {
+      //  the epoch is not saved, so unlocated lines are stale
+      //
+      lin_u->epo_w = 0;
+    }
   }
 }
 
 /* _cj_site_lock(): ensure site has a valid program pointer
  */
 static void
-_cj_site_lock(u3_noun loc, u3_noun cor, u3j_site* sit_u)
+_cj_site_lock(u3_weak loc, u3_noun cor, u3j_site* sit_u, u3j_line* lin_u)
 {
-  if ( (u3_none != sit_u->bat) &&
-       (c3y == u3r_sing(sit_u->bat, u3h(cor))) ) {
-    return;
+  //  a nested kick at this site may have moved the line
+  //
+  if ( (u3_none != lin_u->bat) &&
+       (c3y == u3r_sing(lin_u->bat, u3h(cor))) )
+  {
+    if ( 0 == lin_u->pog_p ) {
+      lin_u->pog_p = _cj_prog(loc, u3x_at(sit_u->axe, cor));
+    }
+    sit_u->pog_p = lin_u->pog_p;
   }
-  sit_u->pog_p = _cj_prog(loc, u3x_at(sit_u->axe, cor));
-  if ( u3_none != sit_u->bat ) {
-    u3z(sit_u->bat);
+  else {
+    sit_u->pog_p = _cj_prog(loc, u3x_at(sit_u->axe, cor));
   }
-  sit_u->bat = u3k(u3h(cor));
 }
 
 /* _cj_burn(): stop tracing glu and call a nock program
@@ -1503,43 +1643,50 @@ _cj_burn(u3p(u3n_prog) pog_p, u3_noun cor)
 **                      (no validity checks).
 */
 static u3_weak
-_cj_site_kick_hot(u3_noun loc, u3_noun cor, u3j_site* sit_u, c3_o lok_o)
+_cj_site_kick_hot(u3_noun   loc,
+                  u3_noun   cor,
+                  u3j_site* sit_u,
+                  u3j_line* lin_u,
+                  c3_o      lok_o)
 {
   u3_weak pro = u3_none;
-  c3_o jet_o  = sit_u->jet_o;
+  c3_o jet_o  = lin_u->jet_o;
   c3_o pof_o  =  __(u3C.wag_w & u3o_debug_cpu);
   c3_o trc_o  =  __(u3C.wag_w & u3o_trace);
 
   if ( c3n == pof_o && c3n == trc_o ) {
     if ( c3y == jet_o ) {
       u3t_off(glu_o);
-      pro = _cj_kick_z(cor, sit_u->cop_u, sit_u->ham_u, sit_u->axe);
+      pro = _cj_kick_z(cor, lin_u->cop_u, lin_u->ham_u, sit_u->axe);
       u3t_on(glu_o);
     }
     if ( u3_none == pro ) {
       if ( c3y == lok_o ) {
-        _cj_site_lock(loc, cor, sit_u);
+        _cj_site_lock(loc, cor, sit_u, lin_u);
       }
     }
   }
   else {
     if ( _(pof_o) ) {
-      pof_o = u3t_come(sit_u->lab);
+      pof_o = u3t_come(lin_u->lab);
     }
     if ( _(trc_o) ) {
-      trc_o = u3t_nock_trace_push(sit_u->lab);
+      trc_o = u3t_nock_trace_push(lin_u->lab);
     }
 
     if ( c3y == jet_o ) {
       u3t_off(glu_o);
-      pro = _cj_kick_z(cor, sit_u->cop_u, sit_u->ham_u, sit_u->axe);
+      pro = _cj_kick_z(cor, lin_u->cop_u, lin_u->ham_u, sit_u->axe);
       u3t_on(glu_o);
     }
     if ( u3_none == pro ) {
       if ( c3y == lok_o ) {
-        _cj_site_lock(loc, cor, sit_u);
+        _cj_site_lock(loc, cor, sit_u, lin_u);
+        pro = _cj_burn(sit_u->pog_p, cor);
+      }
+      else {
+        pro = _cj_burn(lin_u->pog_p, cor);
       }
-      pro = _cj_burn(sit_u->pog_p, cor);
     }
 
     if ( c3y == pof_o ) {
@@ -1553,59 +1700,128 @@ _cj_site_kick_hot(u3_noun loc, u3_noun cor, u3j_site* sit_u, c3_o lok_o)
   return pro;
 }
 
-/* _cj_site_kick(): execute site's kick on core.
- */
-static u3_weak
-_cj_site_kick(u3_noun cor, u3j_site* sit_u)
+/* _cj_dark(): yes if no registration can locate a core with battery
+**             bat (of bash bas) until the cold state changes. RETAIN.
+*/
+static c3_o
+_cj_dark(u3_noun bat, u3_weak bas)
 {
-  u3_weak loc, pro;
+  u3_weak bar = _cj_find_cold(bat);
 
-  loc = pro = u3_none;
+  if ( u3_none != bar ) {
+    u3z(bar);
+    return c3n;
+  }
+  else if ( !(u3C.wag_w & u3o_hashless) ) {
+    return __( (u3_none != bas) &&
+               (u3_none == u3h_git(u3H->rod_u.jed.hot_p, bas)) );
+  }
+  else {
+    return c3y;
+  }
+}
 
-  if ( u3_none != sit_u->loc ) {
-    if ( c3y == _cj_fine(cor, sit_u->fin_p) ) {
-      loc = sit_u->loc;
-      pro = _cj_site_kick_hot(loc, cor, sit_u, c3y);
+/* _cj_line_fine(): yes if line caches the target of cor. RETAIN.
+*/
+static inline c3_o
+_cj_line_fine(u3j_line* lin_u, u3_noun cor)
+{
+  if ( c3n == u3r_sing(lin_u->bat, u3h(cor)) ) {
+    return c3n;
+  }
+  else if ( u3_none == lin_u->loc ) {
+    return __( (0 != lin_u->epo_w) && (u3D.epo_w == lin_u->epo_w) );
+  }
+  else {
+    return _cj_fine(cor, lin_u->fin_p);
+  }
+}
+
+/* _cj_site_fill(): slow path, spot cor and cache it in a fresh line
+**                  at the front of the site. RETAIN.
+*/
+static u3j_line*
+_cj_site_fill(u3_noun cor, u3j_site* sit_u)
+{
+  u3_noun   bat   = u3h(cor);
+  u3j_line* lin_u = sit_u->lin_u;
+  u3_weak   bas   = u3_none;
+  u3j_line  old_u;
+  c3_w      i_w;
+
+  //  evict a stale line for this battery (reusing its bash),
+  //  else the first empty line, else the oldest
+  //
+  for ( i_w = 0; i_w < (u3j_site_ways - 1); i_w++ ) {
+    if ( (u3_none == lin_u[i_w].bat) ||
+         (c3y == u3r_sing(lin_u[i_w].bat, bat)) )
+    {
+      break;
     }
   }
 
-  if ( u3_none == loc ) {
-    loc = _cj_spot(cor, &(sit_u->bas));
-    if ( u3_none != loc ) {
-      u3p(u3j_fink) fon_p = 0;
-      u3_weak  lod   = u3_none;
-      u3_weak  lob   = u3_none;
-
-      if ( u3_none != sit_u->loc ) {
-        lod = sit_u->loc;
-        lob = sit_u->lab;
-        if ( c3y == sit_u->fon_o ) {
-          fon_p = sit_u->fin_p;
-        }
-      }
+  old_u = lin_u[i_w];
+  memmove(&(lin_u[1]), &(lin_u[0]), i_w * sizeof(u3j_line));
+  _cj_line_init(lin_u);
 
-      sit_u->loc   = loc;
-      sit_u->fin_p = _cj_cast(cor, loc);
-      sit_u->fon_o = c3y;
-      sit_u->jet_o = _cj_nail(loc, sit_u->axe,
-          &(sit_u->lab), &(sit_u->cop_u), &(sit_u->ham_u));
-      pro = _cj_site_kick_hot(loc, cor, sit_u, c3y);
-
-      if ( u3_none != lod ) {
-        u3z(lod);
-        u3z(lob);
-        if ( 0 != fon_p ) {
-          _cj_fink_free(fon_p);
-        }
-      }
+  if ( u3_none != old_u.bat ) {
+    if ( c3y == u3r_sing(old_u.bat, bat) ) {
+      bas = old_u.bas;
+      old_u.bas = u3_none;
     }
+    _cj_line_lose(&old_u);
   }
 
-  if ( u3_none == pro ) {
-    _cj_site_lock(loc, cor, sit_u);
+  lin_u->bat = u3k(bat);
+  lin_u->loc = _cj_spot(cor, &bas);
+  lin_u->bas = bas;
+
+  if ( u3_none != lin_u->loc ) {
+    lin_u->fin_p = _cj_cast(cor, lin_u->loc);
+    lin_u->fon_o = c3y;
+    lin_u->jet_o = _cj_nail(lin_u->loc, sit_u->axe,
+        &(lin_u->lab), &(lin_u->cop_u), &(lin_u->ham_u));
+  }
+  else if ( c3y == _cj_dark(bat, bas) ) {
+    lin_u->epo_w = u3D.epo_w;
   }
 
-  return pro;
+  return lin_u;
+}
+
+/* _cj_site_kick(): execute site's kick on core.
+ */
+static u3_weak
+_cj_site_kick(u3_noun cor, u3j_site* sit_u)
+{
+  u3j_line* lin_u = NULL;
+  c3_w      i_w;
+
+  for ( i_w = 0; i_w < u3j_site_ways; i_w++ ) {
+    if ( u3_none == sit_u->lin_u[i_w].bat ) {
+      break;
+    }
+    else if ( c3y == _cj_line_fine(&(sit_u->lin_u[i_w]), cor) ) {
+      lin_u = &(sit_u->lin_u[i_w]);
+      break;
+    }
+  }
+
+  if ( NULL != lin_u ) {
+    sit_u->hit_w++;
+  }
+  else {
+    sit_u->mis_w++;
+    lin_u = _cj_site_fill(cor, sit_u);
+  }
+
+  if ( u3_none != lin_u->loc ) {
+    return _cj_site_kick_hot(lin_u->loc, cor, sit_u, lin_u, c3y);
+  }
+  else {
+    _cj_site_lock(u3_none, cor, sit_u, lin_u);
+    return u3_none;
+  }
 }
 
 /* u3j_site_kick(): kick a core with a u3j_site cache.
@@ -1671,17 +1887,18 @@ u3j_kink(u3_noun cor, u3_noun axe)
 void
 u3j_gate_prep(u3j_site* sit_u, u3_noun cor)
 {
-  u3_noun loc;
+  u3j_line* lin_u;
+  u3_noun   loc;
   u3t_on(glu_o);
   if ( c3n == u3du(cor) || c3n == u3du(u3t(cor)) ) {
     u3m_bail(c3__exit);
     return;
   }
-  sit_u->bas   = u3_none;
-  sit_u->axe   = 2;
-  sit_u->bat   = cor; // a lie, this isn't really the battery!
-  sit_u->loc   = loc = _cj_spot(cor, &(sit_u->bas));
-  sit_u->pog_p = _cj_prog(loc, u3h(cor));
+  u3j_site_init(sit_u, 2);
+  lin_u = &(sit_u->lin_u[0]);
+  lin_u->bat   = cor; // a lie, this isn't really the battery!
+  lin_u->loc   = loc = _cj_spot(cor, &(lin_u->bas));
+  lin_u->pog_p = sit_u->pog_p = _cj_prog(loc, u3h(cor));
   if ( u3_none != loc ) {
     u3_noun pax = _cj_loc_axe(loc),
             pay = u3qc_cap(pax),
@@ -1691,13 +1908,13 @@ u3j_gate_prep(u3j_site* sit_u, u3_noun cor)
       u3m_p("axis", pax);
       u3_weak act = _cj_find_warm(loc);
       c3_assert( u3_none != act );
-      sit_u->jet_o = c3n;
-      sit_u->lab = u3k(u3h(u3t(u3t(act))));
+      lin_u->jet_o = c3n;
+      lin_u->lab = u3k(u3h(u3t(u3t(act))));
       u3z(act);
     }
     else {
-      sit_u->jet_o = _cj_nail(loc, 2,
-        &(sit_u->lab), &(sit_u->cop_u), &(sit_u->ham_u));
+      lin_u->jet_o = _cj_nail(loc, 2,
+        &(lin_u->lab), &(lin_u->cop_u), &(lin_u->ham_u));
     }
     u3z(pam); u3z(pax);
   }
@@ -1710,19 +1927,20 @@ u3j_gate_prep(u3j_site* sit_u, u3_noun cor)
 u3_noun
 u3j_gate_slam(u3j_site* sit_u, u3_noun sam)
 {
-  u3_weak pro;
-  u3_noun cor;
+  u3j_line* lin_u = &(sit_u->lin_u[0]);
+  u3_weak   pro;
+  u3_noun   cor;
 
   u3t_on(glu_o);
   pro = u3_none;
-  cor = u3nt(u3k(u3h(sit_u->bat)),
+  cor = u3nt(u3k(u3h(lin_u->bat)),
              sam,
-             u3k(u3t(u3t(sit_u->bat))));
-  if ( u3_none != sit_u->loc ) {
-    pro = _cj_site_kick_hot(sit_u->loc, cor, sit_u, c3n);
+             u3k(u3t(u3t(lin_u->bat))));
+  if ( u3_none != lin_u->loc ) {
+    pro = _cj_site_kick_hot(lin_u->loc, cor, sit_u, lin_u, c3n);
   }
   if ( u3_none == pro ) {
-    pro = _cj_burn(sit_u->pog_p, cor);
+    pro = _cj_burn(lin_u->pog_p, cor);
   }
   u3t_off(glu_o);
   return pro;
@@ -1733,11 +1951,13 @@ u3j_gate_slam(u3j_site* sit_u, u3_noun sam)
 void
 u3j_gate_lose(u3j_site* sit_u)
 {
-  u3z(sit_u->bat);
-  u3z(sit_u->bas);
-  if ( u3_none != sit_u->loc ) {
-    u3z(sit_u->loc);
-    u3z(sit_u->lab);
+  u3j_line* lin_u = &(sit_u->lin_u[0]);
+
+  u3z(lin_u->bat);
+  u3z(lin_u->bas);
+  if ( u3_none != lin_u->loc ) {
+    u3z(lin_u->loc);
+    u3z(lin_u->lab);
   }
 }
 
@@ -1847,6 +2067,7 @@ _cj_mine(u3_noun cey, u3_noun cor, u3_noun bas)
     hap   = _cj_warm_hump(jax_l, u3t(u3t(loc)));
     act   = u3nq(jax_l, hap, bal, _cj_jit(jax_l, bat));
     u3h_put(u3R->jed.cod_p, bat, u3nc(u3k(bas), reg));
+    u3D.epo_w++;
     u3h_put(u3R->jed.war_p, loc, act); // see note in _cj_spot
     u3z(pel); u3z(axe);
   }
@@ -2057,6 +2278,7 @@ u3j_reap(u3a_jets jed_u)
   u3h_free(jed_u.war_p);
 
   u3h_uni(u3R->jed.cod_p, jed_u.cod_p);
+  u3D.epo_w++;
   u3h_free(jed_u.cod_p);
 
   u3h_walk_with(jed_u.han_p, _cj_merge_hank_cb, &u3R->jed.han_p);
@@ -2198,6 +2420,7 @@ u3j_load(u3_noun rel)
     u3x_cell(ler, &lor, &ler);
     u3h_put(u3R->jed.cod_p, u3h(lor), u3k(u3t(lor)));
   }
+  u3D.epo_w++;
 
   u3z(rel);
 }
@@ -2222,19 +2445,11 @@ _cj_fink_mark(u3j_fink* fin_u)
 void
 u3j_site_lose(u3j_site* sit_u)
 {
+  c3_w i_w;
+
   u3z(sit_u->axe);
-  if ( u3_none != sit_u->bat ) {
-    u3z(sit_u->bat);
-  }
-  if ( u3_none != sit_u->bas ) {
-    u3z(sit_u->bas);
-  }
-  if ( u3_none != sit_u->loc ) {
-    u3z(sit_u->loc);
-    u3z(sit_u->lab);
-    if ( c3y == sit_u->fon_o ) {
-      _cj_fink_free(sit_u->fin_p);
-    }
+  for ( i_w = 0; i_w < u3j_site_ways; i_w++ ) {
+    _cj_line_lose(&(sit_u->lin_u[i_w]));
   }
 }
 
@@ -2268,20 +2483,108 @@ c3_w
 u3j_site_mark(u3j_site* sit_u)
 {
   c3_w tot_w = u3a_mark_noun(sit_u->axe);
-  if ( u3_none != sit_u->bat ) {
-    tot_w += u3a_mark_noun(sit_u->bat);
+  c3_w i_w;
+
+  for ( i_w = 0; i_w < u3j_site_ways; i_w++ ) {
+    u3j_line* lin_u = &(sit_u->lin_u[i_w]);
+
+    if ( u3_none != lin_u->bat ) {
+      tot_w += u3a_mark_noun(lin_u->bat);
+    }
+    if ( u3_none != lin_u->bas ) {
+      tot_w += u3a_mark_noun(lin_u->bas);
+    }
+    if ( u3_none != lin_u->loc ) {
+      tot_w += u3a_mark_noun(lin_u->loc);
+      tot_w += u3a_mark_noun(lin_u->lab);
+      if ( c3y == lin_u->fon_o ) {
+        tot_w += _cj_fink_mark(u3to(u3j_fink, lin_u->fin_p));
+      }
+    }
   }
-  if ( u3_none != sit_u->bas ) {
-    tot_w += u3a_mark_noun(sit_u->bas);
+  return tot_w;
+}
+
+/* _cj_rewrite_weak(): rewrite a u3_weak field for compaction.
+*/
+static void
+_cj_rewrite_weak(u3_weak* som)
+{
+  if ( u3_none != *som ) {
+    u3a_rewrite_noun(*som);
+    *som = u3a_rewritten_noun(*som);
   }
-  if ( u3_none != sit_u->loc ) {
-    tot_w += u3a_mark_noun(sit_u->loc);
-    tot_w += u3a_mark_noun(sit_u->lab);
-    if ( c3y == sit_u->fon_o ) {
-      tot_w += _cj_fink_mark(u3to(u3j_fink, sit_u->fin_p));
+}
+
+/* _cj_fink_rewrite(): rewrite a u3j_fink pointer for compaction.
+*/
+static u3p(u3j_fink)
+_cj_fink_rewrite(u3p(u3j_fink) fin_p)
+{
+  u3j_fink* fin_u = u3to(u3j_fink, fin_p);
+  c3_w      i_w;
+
+  //  finks may be shared between sites and rites
+  //
+  if ( c3y == u3a_rewrite_ptr(fin_u) ) {
+    _cj_rewrite_weak(&(fin_u->sat));
+
+    for ( i_w = 0; i_w < fin_u->len_w; ++i_w ) {
+      u3j_fist* fis_u = &(fin_u->fis_u[i_w]);
+      _cj_rewrite_weak(&(fis_u->bat));
+      _cj_rewrite_weak(&(fis_u->pax));
+    }
+  }
+
+  return u3a_rewritten(fin_p);
+}
+
+/* u3j_rite_rewrite(): rewrite u3j_rite for compaction.
+*/
+void
+u3j_rite_rewrite(u3j_rite* rit_u)
+{
+  if ( u3_none != rit_u->clu ) {
+    _cj_rewrite_weak(&(rit_u->clu));
+    rit_u->fin_p = _cj_fink_rewrite(rit_u->fin_p);
+  }
+}
+
+/* u3j_site_rewrite(): rewrite u3j_site for compaction.
+**
+**   program pointers are u3a_malloc()'d, see u3n_rewrite_compact().
+*/
+void
+u3j_site_rewrite(u3j_site* sit_u)
+{
+  c3_w i_w;
+
+  _cj_rewrite_weak(&(sit_u->axe));
+
+  if ( 0 != sit_u->pog_p ) {
+    sit_u->pog_p = u3a_rewritten_mptr(sit_u->pog_p);
+  }
+
+  for ( i_w = 0; i_w < u3j_site_ways; i_w++ ) {
+    u3j_line* lin_u = &(sit_u->lin_u[i_w]);
+
+    if ( u3_none == lin_u->bat ) {
+      continue;
+    }
+
+    if ( 0 != lin_u->pog_p ) {
+      lin_u->pog_p = u3a_rewritten_mptr(lin_u->pog_p);
+    }
+
+    _cj_rewrite_weak(&(lin_u->bat));
+    _cj_rewrite_weak(&(lin_u->bas));
+
+    if ( u3_none != lin_u->loc ) {
+      _cj_rewrite_weak(&(lin_u->loc));
+      _cj_rewrite_weak(&(lin_u->lab));
+      lin_u->fin_p = _cj_fink_rewrite(lin_u->fin_p);
     }
   }
-  return tot_w;
 }
 
 /* _cj_mark_hank(): mark hank cache for gc.
@@ -2298,6 +2601,188 @@ _cj_mark_hank(u3_noun kev, void* dat)
   }
 }
 
+/* _cj_prof: jet arm metrics, ranked (see u3j_prof()).
+*/
+typedef struct {
+  c3_w       len_w;                     //  arms
+  c3_w       all_w;                     //  allocated
+  u3j_harm** ham_u;                     //  arms, by time and calls
+  c3_c**     lab_c;                     //  dashboard path of each arm
+} _cj_prof;
+
+/* _cj_prof_walk(): collect called arms under dev_u, labelled from pax_c.
+**
+**   arm lists may be shared by several dashboard cores; each is
+**   counted once, under the first path it is found at.
+*/
+static void
+_cj_prof_walk(_cj_prof* pro_u, u3j_core* dev_u, const c3_c* pax_c)
+{
+  c3_w i_w, j_w, k_w;
+
+  if ( !dev_u ) {
+    return;
+  }
+
+  for ( i_w = 0; 0 != dev_u[i_w].cos_c; i_w++ ) {
+    u3j_core* cop_u = &dev_u[i_w];
+    c3_w      len_w = strlen(cop_u->cos_c) + (pax_c ? strlen(pax_c) + 1 : 0);
+    c3_c*     nex_c = c3_malloc(len_w + 1);
+
+    if ( pax_c ) {
+      snprintf(nex_c, len_w + 1, "%s/%s", pax_c, cop_u->cos_c);
+    }
+    else {
+      snprintf(nex_c, len_w + 1, "%s", cop_u->cos_c);
+    }
+
+    for ( j_w = 0; cop_u->arm_u && cop_u->arm_u[j_w].fcs_c; j_w++ ) {
+      u3j_harm* ham_u = &(cop_u->arm_u[j_w]);
+      c3_w      lab_w = len_w + 1 + strlen(ham_u->fcs_c);
+
+      if ( 0 == ham_u->cal_d ) {
+        continue;
+      }
+
+      for ( k_w = 0; k_w < pro_u->len_w; k_w++ ) {
+        if ( ham_u == pro_u->ham_u[k_w] ) {
+          break;
+        }
+      }
+
+      if ( k_w < pro_u->len_w ) {
+        continue;
+      }
+
+      if ( pro_u->len_w == pro_u->all_w ) {
+        pro_u->all_w = 2 * pro_u->all_w + 16;
+        pro_u->ham_u = c3_realloc(pro_u->ham_u,
+                                  pro_u->all_w * sizeof(u3j_harm*));
+        pro_u->lab_c = c3_realloc(pro_u->lab_c,
+                                  pro_u->all_w * sizeof(c3_c*));
+      }
+
+      pro_u->ham_u[pro_u->len_w] = ham_u;
+      pro_u->lab_c[pro_u->len_w] = c3_malloc(lab_w + 1);
+      snprintf(pro_u->lab_c[pro_u->len_w], lab_w + 1,
+               "%s/%s", nex_c, ham_u->fcs_c);
+      pro_u->len_w++;
+    }
+
+    _cj_prof_walk(pro_u, cop_u->dev_u, nex_c);
+    c3_free(nex_c);
+  }
+}
+
+/* _cj_prof_rank(): collect and rank called arms, by time and then calls.
+*/
+static void
+_cj_prof_rank(_cj_prof* pro_u)
+{
+  c3_w i_w, j_w;
+
+  memset(pro_u, 0, sizeof(*pro_u));
+  _cj_prof_walk(pro_u, u3D.dev_u, 0);
+
+  //  insertion sort: a few hundred arms at most, and mostly in order
+  //
+  for ( i_w = 1; i_w < pro_u->len_w; i_w++ ) {
+    u3j_harm* ham_u = pro_u->ham_u[i_w];
+    c3_c*     lab_c = pro_u->lab_c[i_w];
+
+    for ( j_w = i_w; j_w > 0; j_w-- ) {
+      u3j_harm* hem_u = pro_u->ham_u[j_w - 1];
+
+      if (  (hem_u->tim_d > ham_u->tim_d)
+         || ( (hem_u->tim_d == ham_u->tim_d)
+           && (hem_u->cal_d >= ham_u->cal_d) ) )
+      {
+        break;
+      }
+      pro_u->ham_u[j_w] = hem_u;
+      pro_u->lab_c[j_w] = pro_u->lab_c[j_w - 1];
+    }
+    pro_u->ham_u[j_w] = ham_u;
+    pro_u->lab_c[j_w] = lab_c;
+  }
+}
+
+/* _cj_prof_free(): dispose of a ranking.
+*/
+static void
+_cj_prof_free(_cj_prof* pro_u)
+{
+  c3_w i_w;
+
+  for ( i_w = 0; i_w < pro_u->len_w; i_w++ ) {
+    c3_free(pro_u->lab_c[i_w]);
+  }
+  c3_free(pro_u->lab_c);
+  c3_free(pro_u->ham_u);
+}
+
+/* _cj_mass_leaf(): $mass leaf [nam %& num].
+*/
+static u3_noun
+_cj_mass_leaf(const c3_c* nam_c, c3_d num_d)
+{
+  return u3nt(u3i_string(nam_c), c3y, u3i_chub(num_d));
+}
+
+/* u3j_prof(): jet arm metrics since boot, as a $mass.
+*/
+u3_noun
+u3j_prof(void)
+{
+  _cj_prof pro_u;
+  u3_noun  lis = u3_nul;
+  c3_w     i_w;
+
+  _cj_prof_rank(&pro_u);
+
+  for ( i_w = pro_u.len_w; i_w--; ) {
+    u3j_harm* ham_u = pro_u.ham_u[i_w];
+    u3_noun   met   = u3i_list(_cj_mass_leaf("calls", ham_u->cal_d),
+                               _cj_mass_leaf("time", ham_u->tim_d),
+                               _cj_mass_leaf("punts", ham_u->pun_d),
+                               _cj_mass_leaf("mismatches", ham_u->mis_d),
+                               u3_none);
+
+    lis = u3nc(u3nt(u3i_string(pro_u.lab_c[i_w]), c3n, met), lis);
+  }
+
+  _cj_prof_free(&pro_u);
+  return u3nt(c3__jets, c3n, lis);
+}
+
+/* u3j_damp(): print the busiest jet arms.
+*/
+void
+u3j_damp(FILE* fil_u)
+{
+  _cj_prof pro_u;
+  c3_w     i_w;
+
+  _cj_prof_rank(&pro_u);
+
+  if ( pro_u.len_w ) {
+    fprintf(fil_u, "jet arms: calls, time, punts, mismatches\r\n");
+  }
+
+  for ( i_w = 0; i_w < c3_min(pro_u.len_w, 32); i_w++ ) {
+    u3j_harm* ham_u = pro_u.ham_u[i_w];
+
+    fprintf(fil_u, "  %s: %" PRIu64 ", %.3f ms, %" PRIu64 ", %" PRIu64 "\r\n",
+                   pro_u.lab_c[i_w],
+                   ham_u->cal_d,
+                   ham_u->tim_d / 1e6,
+                   ham_u->pun_d,
+                   ham_u->mis_d);
+  }
+
+  _cj_prof_free(&pro_u);
+}
+
 /* u3j_mark(): mark jet state for gc.
 */
 c3_w
@@ -2375,6 +2860,7 @@ u3j_reclaim(void)
  *
  * NB: u3R->jed.han_p *must* be cleared (currently via u3j_reclaim above)
  * since it contains hanks which are not nouns but have loom pointers.
+ * (Bytecode programs are rewritten in place, see u3n_rewrite_compact().)
  * Alternately, rewrite the entries with u3h_walk, using u3j_mark as a
  * template for how to walk.  There's an untested attempt at this in git
  * history at e8a307a.
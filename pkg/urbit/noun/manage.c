@@ -257,10 +257,14 @@ _cm_stack_unwind(void)
   u3_noun tax;
 
   while ( u3R != &(u3H->rod_u) ) {
-    u3_noun yat = u3m_love(u3R->bug.tax);
+    u3_noun yat;
+
+    u3t_flush();
+    yat = u3m_love(u3R->bug.tax);
 
     u3R->bug.tax = u3kb_weld(yat, u3R->bug.tax);
   }
+  u3t_flush();
   tax = u3R->bug.tax;
 
   u3R->bug.tax = 0;
@@ -276,6 +280,9 @@ _cm_signal_recover(c3_l sig_l, u3_noun arg)
 
   //  Unlikely to be set, but it can be made to happen.
   //
+  if ( &(u3H->rod_u) == u3R ) {
+    u3t_flush();
+  }
   tax = u3H->rod_u.bug.tax;
   u3H->rod_u.bug.tax = 0;
 
@@ -577,7 +584,9 @@ _find_home(void)
   {
     c3_w ver_w = *((mem_w + len_w) - 1);
 
-    if ( u3v_version != ver_w ) {
+    //  version 1 images load; see _cm_migrate()
+    //
+    if ( (u3v_version != ver_w) && (1 != ver_w) ) {
       fprintf(stderr, "loom: checkpoint version mismatch: "
                       "have %u, need %u\r\n",
                       ver_w,
@@ -733,6 +742,8 @@ u3m_bail(u3_noun how)
 
   /* Reconstruct a correct error ball.
   */
+  u3t_flush();
+
   if ( _(u3ud(how)) ) {
     switch ( how ) {
       case c3__exit: {
@@ -910,6 +921,7 @@ u3m_love(u3_noun pro)
   //  save cache pointers from current road
   //
   u3p(u3h_root) byc_p = u3R->byc.har_p;
+  u3p(u3h_root) mem_p = u3R->mem.har_p;
   u3a_jets      jed_u = u3R->jed;
 
   //  fallback to parent road (child heap on parent's stack)
@@ -921,6 +933,7 @@ u3m_love(u3_noun pro)
   pro   = u3a_take(pro);
   jed_u = u3j_take(jed_u);
   byc_p = u3n_take(byc_p);
+  mem_p = u3n_memo_take(mem_p);
 
   //  pop the stack
   //
@@ -931,6 +944,7 @@ u3m_love(u3_noun pro)
   //
   u3j_reap(jed_u);
   u3n_reap(byc_p);
+  u3n_memo_reap(mem_p);
 
   return pro;
 }
@@ -998,9 +1012,10 @@ u3m_soft_top(c3_w    mil_w,                     //  timer ms
   _cm_signal_deep(mil_w);
 
   if ( 0 != (sig_l = rsignal_setjmp(u3_Signal)) ) {
-    //  reinitialize trace state
+    //  reinitialize trace and profile state
     //
     u3t_init();
+    u3n_prof_unwind();
 
     //  return to blank state
     //
@@ -1040,6 +1055,8 @@ u3m_soft_top(c3_w    mil_w,                     //  timer ms
     pro = u3nc(0, u3m_love(pro));
   }
   else {
+    u3n_prof_unwind();
+
     /* Overload the error result.
     */
     pro = u3m_love(why);
@@ -1141,6 +1158,7 @@ u3m_soft_run(u3_noun gul,
   }
   else {
     u3t_init();
+    u3n_prof_unwind();
 
     /* Produce - or fall again.
     */
@@ -1164,6 +1182,7 @@ u3m_soft_run(u3_noun gul,
         case 3: {                             //  failure; rebail w/trace
           u3_noun yod = u3m_love(u3t(why));
 
+          u3t_flush();
           u3m_bail
             (u3nt(3,
                   u3a_take(u3h(yod)),
@@ -1228,6 +1247,7 @@ u3m_soft_esc(u3_noun ref, u3_noun sam)
   }
   else {
     u3t_init();
+    u3n_prof_unwind();
 
     /* Push the error back up to the calling context - not the run we
     ** are in, but the caller of the run, matching pure nock semantics.
@@ -1770,6 +1790,28 @@ u3m_stop()
   u3je_secp_stop();
 }
 
+/* _cm_migrate(): upgrade a restored image to u3v_version.
+**
+**   version 2 changed the layout of u3n_prog and of the u3j_site
+**   kick caches in it, so version 1 bytecode and hank caches are
+**   dropped without being walked.  the blocks they held are leaked
+**   until the next mark and sweep reclaims them.
+*/
+static void
+_cm_migrate(void)
+{
+  u3l_log("loom: migrating image from version %u to %u\r\n",
+          u3H->ver_w, u3v_version);
+
+  u3h_free(u3R->jed.han_p);
+  u3R->jed.han_p = u3h_new();
+
+  u3h_free(u3R->byc.har_p);
+  u3R->byc.har_p = u3h_new();
+
+  u3H->ver_w = u3v_version;
+}
+
 /* u3m_boot(): start the u3 system. return next event, starting from 1.
 */
 c3_d
@@ -1806,6 +1848,10 @@ u3m_boot(c3_c* dir_c)
   /* Reactivate jets on old kernel.
   */
   if ( c3n == nuu_o ) {
+    if ( u3v_version != u3H->ver_w ) {
+      _cm_migrate();
+    }
+
     u3j_ream();
     u3n_ream();
 
@@ -1869,7 +1915,7 @@ _cm_pack_rewrite(void)
   //
   c3_assert( &(u3H->rod_u) == u3R );
 
-  //  NB: these implementations must be kept in sync with u3m_reclaim();
+  //  NB: these implementations must be kept in sync with u3m_pack();
   //  anything not reclaimed must be rewritable
   //
   u3v_rewrite_compact();
@@ -1887,7 +1933,12 @@ u3m_pack(void)
 
   //  reclaim first, to free space, and discard anything we can't/don't rewrite
   //
-  u3m_reclaim();
+  //    the bytecode cache is kept (see u3n_rewrite_compact()),
+  //    so that packing isn't followed by a recompilation storm
+  //
+  u3v_reclaim();
+  u3j_reclaim();
+  u3a_reclaim();
 
   //  sweep the heap, finding and saving new locations
   //
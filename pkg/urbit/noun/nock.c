@@ -2,11 +2,22 @@
 **
 */
 #include "all.h"
+#include "vere/vere.h"
+#include <time.h>
 
 // define to have each opcode printed as it executes,
 // along with some other debugging info
 #        undef VERBOSE_BYTECODE
 
+// define to run programs from their direct-threaded form (see
+// _n_thread()), rather than decoding bytecode as we go
+#        define THREADED_BYTECODE
+
+#ifdef VERBOSE_BYTECODE
+//  verbose printing walks the bytecode itself
+#  undef THREADED_BYTECODE
+#endif
+
 #if 0
 // Retained for debugging purposes.
 static u3_noun _n_nock_on(u3_noun bus, u3_noun fol);
@@ -384,6 +395,8 @@ _n_nock_on(u3_noun bus, u3_noun fol)
 
 // Several opcodes "overflow" (from byte to short index) to their successor, so
 // order can matter here.
+// Bytecode programs are persisted in the home road's cache, so new opcodes
+// must be appended (just before LAST) rather than renumbering existing ones.
 // Note that we use an X macro (https://en.wikipedia.org/wiki/X_Macro) to unify
 // the opcode's enum name, string representation, and computed goto into a
 // single structure.
@@ -503,7 +516,28 @@ _n_nock_on(u3_noun bus, u3_noun fol)
   X(KUTS, "kuts", &&do_kuts),  /* 92 */                                        \
   X(KITB, "kitb", &&do_kitb),  /* 93 */                                        \
   X(KITS, "kits", &&do_kits),  /* 94 */                                        \
-  X(LAST,   NULL,      NULL),  /* 95 */
+  /* superinstructions (see _n_fuse()) */                                      \
+  X(ZBIN, "zbin", &&do_zbin),  /* 95: sam0, sbin */                            \
+  X(ZINS, "zins", &&do_zins),  /* 96: sam0, sins */                            \
+  X(ZWIN, "zwin", &&do_zwin),  /* 97: sam0, swin */                            \
+  X(DBIN, "dbin", &&do_dbin),  /* 98: deep, sbin */                            \
+  X(DINS, "dins", &&do_dins),  /* 99: deep, sins */                            \
+  X(DWIN, "dwin", &&do_dwin),  /* 100: deep, swin */                           \
+  X(KOPB, "kopb", &&do_kopb),  /* 101: copy, kicb */                           \
+  X(KOPS, "kops", &&do_kops),  /* 102: copy, kics */                           \
+  X(PINB, "pinb", &&do_pinb),  /* 103: lit*, snoc */                           \
+  X(PINS, "pins", &&do_pins),  /* 104: lit*, snoc */                           \
+  X(PILB, "pilb", &&do_pilb),  /* 105: lit*, snol */                           \
+  X(PILS, "pils", &&do_pils),  /* 106: lit*, snol */                           \
+  /* nock 2, statically known formula (see _n_know()) */                       \
+  X(DIRB, "dirb", &&do_dirb),  /* 107 */                                       \
+  X(DIRS, "dirs", &&do_dirs),  /* 108 */                                       \
+  X(DITB, "ditb", &&do_ditb),  /* 109 */                                       \
+  X(DITS, "dits", &&do_dits),  /* 110 */                                       \
+  /* trace hint with constant clue, lazy (see u3t_lend()) */                   \
+  X(TAXB, "taxb", &&do_taxb),  /* 111 */                                       \
+  X(TAXS, "taxs", &&do_taxs),  /* 112 */                                       \
+  X(LAST,   NULL,      NULL),  /* 113 */
 
 // Opcodes. Define X to select the enum name from OPCODES.
 #define X(opcode, name, indirect_jump) opcode
@@ -522,6 +556,10 @@ _n_arg(c3_y cod_y)
     case SLIB: case SKIB: case KICB: case TICB:
     case BUSH: case BAST: case BALT:
     case MUTB: case KUTB: case MITB: case KITB:
+    case ZBIN: case DBIN: case KOPB:
+    case PINB: case PILB:
+    case DIRB: case DITB:
+    case TAXB:
       return sizeof(c3_y);
 
     case FASK: case FASL: case FISL: case FISK:
@@ -530,9 +568,14 @@ _n_arg(c3_y cod_y)
     case SLIS: case SKIS: case KICS: case TICS:
     case SUSH: case SAST: case SALT:
     case MUTS: case KUTS: case MITS: case KITS:
+    case ZINS: case DINS: case KOPS:
+    case PINS: case PILS:
+    case DIRS: case DITS:
+    case TAXS:
       return sizeof(c3_s);
 
     case SWIP: case SWIN:
+    case ZWIN: case DWIN:
       return sizeof(c3_l);
 
     default:
@@ -585,7 +628,8 @@ _n_melt(u3_noun ops, c3_w* byc_w, c3_w* cal_w,
           siz_y[i_w] = 1 + _n_arg(cod_y);
           break;
 
-        case SBIP: case SBIN: {
+        case SBIP: case SBIN:
+        case ZBIN: case DBIN: {
           c3_l tot_l = 0,
                sip_l = u3t(op);
           c3_w j_w, k_w = i_w;
@@ -623,11 +667,15 @@ _n_melt(u3_noun ops, c3_w* byc_w, c3_w* cal_w,
         case SAST: case SALT: case KICS: case TICS:
         case FISK: case FISL: case SUSH: case SANS:
         case LISL: case LISK: case SKIS: case SLIS:
-        case HILS: case HINS:
+        case HILS: case HINS: case ZINS: case ZWIN:
+        case DINS: case DWIN: case KOPS: case PINS:
+        case PILS: case DIRS: case DITS:
+        case TAXS:
           c3_assert(0); //overflows
           break;
 
-        case KICB: case TICB:
+        case KICB: case TICB: case KOPB:
+        case DIRB: case DITB:
           a_w = (*cal_w)++;
           if ( a_w <= 0xFF ) {
             siz_y[i_w] = 2;
@@ -645,6 +693,8 @@ _n_melt(u3_noun ops, c3_w* byc_w, c3_w* cal_w,
         case SANB: case LIBL: case LIBK:
         case KITB: case MITB:
         case HILB: case HINB:
+        case PINB: case PILB:
+        case TAXB:
           a_w = (*lit_w)++;
           if ( a_w <= 0xFF ) {
             siz_y[i_w] = 2;
@@ -668,6 +718,13 @@ _n_melt(u3_noun ops, c3_w* byc_w, c3_w* cal_w,
   return u3kb_flop(sip);
 }
 
+/* burnframe: return address, saved on the stack by non-tail calls.
+ */
+typedef struct {
+  u3n_prog* pog_u;
+  c3_w     ip_w;
+} burnframe;
+
 /* _n_prog_dat(): return pointer to program's data segment
  */
 static void*
@@ -679,19 +736,25 @@ _n_prog_dat(u3n_prog* pog_u)
 /* _n_prog_new(): allocate and set up pointers for u3n_prog
  */
 static u3n_prog*
-_n_prog_new(c3_w byc_w, c3_w cal_w,
+_n_prog_new(c3_w byc_w, c3_w thr_w, c3_w cal_w,
             c3_w reg_w, c3_w lit_w, c3_w mem_w)
 {
-  c3_w cab_w = (sizeof(u3j_site) * cal_w),
+  c3_w teb_w = (sizeof(u3n_slot) * thr_w),
+       cab_w = (sizeof(u3j_site) * cal_w),
        reb_w = (sizeof(u3j_rite) * reg_w),
        lib_w = (sizeof(u3_noun) * lit_w),
        meb_w = (sizeof(u3n_memo) * mem_w),
-       dat_w = byc_w + cab_w + reb_w + lib_w + meb_w;
+       dat_w = teb_w + byc_w + cab_w + reb_w + lib_w + meb_w;
 
   u3n_prog* pog_u     = u3a_malloc(sizeof(u3n_prog) + dat_w);
+  pog_u->thr_u.liv_o = c3n;
+  pog_u->thr_u.len_w = thr_w;
+  pog_u->thr_u.ops_u = (u3n_slot*) _n_prog_dat(pog_u);
+
   pog_u->byc_u.own_o = c3y;
   pog_u->byc_u.len_w = byc_w;
-  pog_u->byc_u.ops_y = (c3_y*) _n_prog_dat(pog_u);
+  pog_u->byc_u.hig_w = 0;
+  pog_u->byc_u.ops_y = (c3_y*) (pog_u->thr_u.ops_u + pog_u->thr_u.len_w);
 
   pog_u->lit_u.len_w = lit_w;
   pog_u->lit_u.non   = (u3_noun*) (pog_u->byc_u.ops_y + pog_u->byc_u.len_w);
@@ -705,6 +768,8 @@ _n_prog_new(c3_w byc_w, c3_w cal_w,
   pog_u->reg_u.len_w = reg_w;
   pog_u->reg_u.rit_u = (u3j_rite*) (pog_u->cal_u.sit_u + pog_u->cal_u.len_w);
 
+  pog_u->mug_l = 0;
+
   return pog_u;
 }
 
@@ -723,7 +788,9 @@ _n_prog_old(u3n_prog* sep_u)
   u3n_prog* pog_u     = u3a_malloc(sizeof(u3n_prog) + dat_w);
   pog_u->byc_u.own_o = c3n;
   pog_u->byc_u.len_w = sep_u->byc_u.len_w;
+  pog_u->byc_u.hig_w = sep_u->byc_u.hig_w;
   pog_u->byc_u.ops_y = sep_u->byc_u.ops_y;
+  pog_u->thr_u       = sep_u->thr_u;
 
   pog_u->lit_u.len_w = sep_u->lit_u.len_w;
   pog_u->lit_u.non   = (u3_noun*) _n_prog_dat(pog_u);
@@ -737,6 +804,8 @@ _n_prog_old(u3n_prog* sep_u)
   pog_u->reg_u.len_w = sep_u->reg_u.len_w;
   pog_u->reg_u.rit_u = (u3j_rite*) (pog_u->cal_u.sit_u + pog_u->cal_u.len_w);
 
+  pog_u->mug_l = sep_u->mug_l;
+
   memcpy(pog_u->lit_u.non, sep_u->lit_u.non, dat_w);
   return pog_u;
 }
@@ -815,7 +884,8 @@ _n_prog_asm(u3_noun ops, u3n_prog* pog_u, u3_noun sip)
         }
 
         /* skips */
-        case SBIP: case SBIN: {
+        case SBIP: case SBIN:
+        case ZBIN: case DBIN: {
           c3_l sip_l  = u3h(sip);
           u3_noun tmp = sip;
           sip = u3k(u3t(sip));
@@ -877,25 +947,17 @@ _n_prog_asm(u3_noun ops, u3n_prog* pog_u, u3_noun sip)
         case BUSH: case SANB:
         case KITB: case MITB:
         case HILB: case HINB:
+        case PINB: case PILB:
+        case TAXB:
           _n_prog_asm_inx(buf_y, &i_w, lit_s, cod);
           pog_u->lit_u.non[lit_s++] = u3k(u3t(op));
           break;
 
         /* call site index args */
-        case TICB: case KICB: {
+        case TICB: case KICB: case KOPB:
+        case DIRB: case DITB: {
           _n_prog_asm_inx(buf_y, &i_w, cal_s, cod);
-          u3j_site* sit_u = &(pog_u->cal_u.sit_u[cal_s++]);
-          sit_u->axe   = u3k(u3t(op));
-          sit_u->pog_p = 0;
-          sit_u->bat   = u3_none;
-          sit_u->bas   = u3_none;
-          sit_u->loc   = u3_none;
-          sit_u->lab   = u3_none;
-          sit_u->jet_o = c3n;
-          sit_u->fon_o = c3n;
-          sit_u->cop_u = NULL;
-          sit_u->ham_u = NULL;
-          sit_u->fin_p = 0;
+          u3j_site_init(&(pog_u->cal_u.sit_u[cal_s++]), u3k(u3t(op)));
           break;
         }
       }
@@ -909,6 +971,136 @@ _n_prog_asm(u3_noun ops, u3n_prog* pog_u, u3_noun sip)
   c3_assert(u3_nul == sip);
 }
 
+/* _n_step(): stack effect of an opcode, as its peak height
+ *            and net change (in words).  No if the opcode
+ *            never falls through.
+ */
+static c3_o
+_n_step(c3_y cod_y, c3_ws* pek_ws, c3_ws* net_ws)
+{
+  *pek_ws = *net_ws = 0;
+
+  switch ( cod_y ) {
+    case HALT: case BAIL:
+    case NOCT: case DITB: case DITS:
+    case SBIP: case SIPS: case SWIP:
+      return c3n;
+
+    //  calls push a frame and the callee's subject
+    //
+    case NOCK: case NOLK:
+    case KICB: case KICS: case KOPB: case KOPS:
+    case DIRB: case DIRS:
+      *pek_ws = c3_wiseof(burnframe) + 1;
+      *net_ws = ( NOCK == cod_y ) ? -1
+              : ( NOLK == cod_y ) ? -2
+              : ( (KOPB == cod_y) || (KOPS == cod_y) ) ? 1 : 0;
+      return c3y;
+
+    case COPY: case HEAD: case TAIL:
+    case FABK: case FASK: case FIBK: case FISK:
+    case LIT0: case LIT1: case LITB: case LITS: case LIBK: case LISK:
+    case PINB: case PINS:
+    case SLIB: case SLIS:
+    case HINB: case HINS:
+      *net_ws = 1;
+      break;
+
+    case SKIB: case SKIS:
+    case HILB: case HILS:
+      *net_ws = 2;
+      break;
+
+    case TOSS: case AUTO: case SNOL: case SAME:
+    case SBIN: case SINS: case SWIN:
+    case ZBIN: case ZINS: case ZWIN:
+    case DBIN: case DINS: case DWIN:
+    case WISH: case BUSH: case SUSH: case HECK: case SLOG:
+    case BAST: case SAST: case SAVE:
+    case HILK: case HILL: case HINK: case HINL:
+    case KUTH: case KUTT: case KUSM:
+    case KUTB: case KUTS: case KITB: case KITS:
+      *net_ws = -1;
+      break;
+
+    case AULT: case SALM: case WILS: case BALT: case SALT:
+    case MUTH: case MUTT: case MUSM:
+    case MUTB: case MUTS: case MITB: case MITS:
+      *net_ws = -2;
+      break;
+
+    default:
+      break;
+  }
+
+  *pek_ws = c3_max(*pek_ws, *net_ws);
+  return c3y;
+}
+
+/* _n_prog_high(): bound the stack height of a program (in words).
+ *
+ *   a program starts with its subject on the stack.  skips are
+ *   forward, and every path to an instruction arrives at the same
+ *   height, so one pass suffices: a skip records the height at its
+ *   target, which is picked up after code that doesn't fall through.
+ *   (%memo hits skip to where the miss path arrives at the same height.)
+ */
+static c3_w
+_n_prog_high(u3n_prog* pog_u)
+{
+  c3_y*  pog   = pog_u->byc_u.ops_y;
+  c3_w   len_w = pog_u->byc_u.len_w;
+  c3_ws* tar_ws = c3_calloc(sizeof(c3_ws) * (len_w + 1));
+  c3_ws  dep_ws = 1, max_ws = 1, pek_ws, net_ws;
+  c3_w   ip_w = 0, sip_w;
+  c3_y   cod_y;
+  c3_o   liv_o = c3y;
+
+  while ( ip_w < len_w ) {
+    //  target heights are stored off by one, so that zero is none
+    //
+    if ( tar_ws[ip_w] ) {
+      dep_ws = ( c3y == liv_o )
+               ? c3_max(dep_ws, tar_ws[ip_w] - 1)
+               : tar_ws[ip_w] - 1;
+    }
+
+    cod_y = pog[ip_w++];
+    liv_o = _n_step(cod_y, &pek_ws, &net_ws);
+
+    max_ws = c3_max(max_ws, dep_ws + pek_ws);
+    dep_ws += net_ws;
+
+    switch ( cod_y ) {
+      default: sip_w = 0; break;
+
+      case SBIP: case SBIN: case ZBIN: case DBIN:
+        sip_w = pog[ip_w];
+        break;
+
+      case SIPS: case SINS: case ZINS: case DINS:
+        sip_w = pog[ip_w] | (pog[ip_w + 1] << 8);
+        break;
+
+      case SWIP: case SWIN: case ZWIN: case DWIN:
+        sip_w = pog[ip_w] | (pog[ip_w + 1] << 8)
+              | (pog[ip_w + 2] << 16) | (pog[ip_w + 3] << 24);
+        break;
+    }
+
+    ip_w += _n_arg(cod_y);
+
+    if ( sip_w ) {
+      c3_w tar_w = ip_w + sip_w;
+      c3_assert( tar_w <= len_w );
+      tar_ws[tar_w] = c3_max(tar_ws[tar_w], dep_ws + 1);
+    }
+  }
+
+  c3_free(tar_ws);
+  return (c3_w)max_ws;
+}
+
 /* _n_prog_from_ops(): new program from _n_comp() product
  */
 static u3n_prog*
@@ -917,14 +1109,19 @@ _n_prog_from_ops(u3_noun ops)
   u3_noun sip;
   u3n_prog* pog_u;
   c3_w byc_w = 1, // HALT
+       thr_w,
        cal_w = 0,
        reg_w = 0,
        lit_w = 0,
        mem_w = 0;
 
   sip   = _n_melt(ops, &byc_w, &cal_w, &reg_w, &lit_w, &mem_w);
-  pog_u = _n_prog_new(byc_w, cal_w, reg_w, lit_w, mem_w);
+  //  a slot per op, plus HALT, plus a skip slot per %memo op
+  //
+  thr_w = u3qb_lent(ops) + 1 + mem_w;
+  pog_u = _n_prog_new(byc_w, thr_w, cal_w, reg_w, lit_w, mem_w);
   _n_prog_asm(ops, pog_u, sip);
+  pog_u->byc_u.hig_w = _n_prog_high(pog_u);
   return pog_u;
 }
 
@@ -956,12 +1153,335 @@ static void _n_print_stack(u3p(u3_noun) empty) {
 }
 #endif
 
-#ifdef VERBOSE_BYTECODE
 // Define X to select the opcode string representation from OPCODES.
 # define X(opcode, name, indirect_jump) name
 static c3_c* opcode_names[] = { OPCODES };
 # undef X
-#endif
+
+/* _n_prof: bytecode profile of one formula, by mug (see u3n_prof()).
+ *
+ *   the table is off-loom, so that it survives the roads and
+ *   cache reclamation that free the programs it describes.
+ */
+typedef struct {
+  c3_l mug_l;                           //  formula mug, 0 if empty
+  c3_w ent_w;                           //  program entries
+  c3_d ops_d;                           //  opcodes dispatched
+  c3_d tim_d;                           //  exclusive burn time (ns)
+  c3_w ran_w;                           //  rank, while ranking
+} _n_prof;
+
+// log2 of the profile table size, and the probe limit
+#define PROF_BITS  14
+#define PROF_PROBE 16
+
+static _n_prof* _n_prof_u;              //  profile table
+static _n_prof  _n_prof_oth_u;          //  overflow record
+static _n_prof* _n_prof_cur_u;          //  record being charged
+static c3_d     _n_prof_now_d;          //  time of last charge
+static c3_d     _n_prof_ops_d[LAST];    //  dispatches by opcode
+static c3_d     _n_pair_d[LAST][LAST];  //  dispatches by opcode pair
+
+/* _n_prof_time(): monotonic nanoseconds.
+ */
+static c3_d
+_n_prof_time(void)
+{
+  struct timespec tim_u;
+
+  clock_gettime(CLOCK_MONOTONIC, &tim_u);
+  return (c3_d)tim_u.tv_sec * 1000000000ULL + (c3_d)tim_u.tv_nsec;
+}
+
+/* _n_prof_find(): find or create the profile record for a formula mug.
+ */
+static _n_prof*
+_n_prof_find(c3_l mug_l)
+{
+  c3_w i_w;
+
+  if ( !_n_prof_u ) {
+    _n_prof_u = c3_calloc(sizeof(_n_prof) << PROF_BITS);
+  }
+
+  for ( i_w = 0; i_w < PROF_PROBE; i_w++ ) {
+    _n_prof* pro_u = &(_n_prof_u[(mug_l + i_w) & ((1 << PROF_BITS) - 1)]);
+
+    if ( mug_l == pro_u->mug_l ) {
+      return pro_u;
+    }
+    else if ( 0 == pro_u->mug_l ) {
+      pro_u->mug_l = mug_l;
+      return pro_u;
+    }
+  }
+
+  return &_n_prof_oth_u;
+}
+
+/* _n_prof_look(): the profile record for a formula mug, if any.
+ */
+static _n_prof*
+_n_prof_look(c3_l mug_l)
+{
+  c3_w i_w;
+
+  if ( !_n_prof_u || !mug_l ) {
+    return 0;
+  }
+
+  for ( i_w = 0; i_w < PROF_PROBE; i_w++ ) {
+    _n_prof* pro_u = &(_n_prof_u[(mug_l + i_w) & ((1 << PROF_BITS) - 1)]);
+
+    if ( mug_l == pro_u->mug_l ) {
+      return pro_u;
+    }
+    else if ( 0 == pro_u->mug_l ) {
+      return 0;
+    }
+  }
+
+  return 0;
+}
+
+/* _n_prof_swap(): charge elapsed time, and switch records (0 for none).
+ *                 produces the previous record.
+ */
+static _n_prof*
+_n_prof_swap(_n_prof* pro_u)
+{
+  c3_d     now_d = _n_prof_time();
+  _n_prof* old_u = _n_prof_cur_u;
+
+  if ( old_u ) {
+    old_u->tim_d += now_d - _n_prof_now_d;
+  }
+
+  _n_prof_now_d = now_d;
+  _n_prof_cur_u = pro_u;
+  return old_u;
+}
+
+/* _n_prof_in(): when profiling, enter pog_u, producing the previous record.
+ */
+static inline _n_prof*
+_n_prof_in(u3n_prog* pog_u)
+{
+  if ( u3C.wag_w & u3o_debug_cpu ) {
+    _n_prof* pro_u = _n_prof_find(pog_u->mug_l);
+
+    pro_u->ent_w++;
+    return _n_prof_swap(pro_u);
+  }
+  return 0;
+}
+
+/* _n_prof_back(): when profiling, return into pog_u.
+ */
+static inline void
+_n_prof_back(u3n_prog* pog_u)
+{
+  if ( u3C.wag_w & u3o_debug_cpu ) {
+    _n_prof_swap(_n_prof_find(pog_u->mug_l));
+  }
+}
+
+/* _n_prof_out(): when profiling, leave the interpreter for pro_u.
+ */
+static inline void
+_n_prof_out(_n_prof* pro_u)
+{
+  if ( u3C.wag_w & u3o_debug_cpu ) {
+    _n_prof_swap(pro_u);
+  }
+}
+
+/* _n_prof_op(): count a dispatch, and the pair it ends with the
+ *               one before it in *pre_y (see do_prof in _n_burn()).
+ */
+static inline void
+_n_prof_op(c3_y* pre_y, c3_y cod_y)
+{
+  _n_prof_ops_d[cod_y]++;
+  _n_pair_d[*pre_y][cod_y]++;
+  *pre_y = cod_y;
+
+  if ( _n_prof_cur_u ) {
+    _n_prof_cur_u->ops_d++;
+  }
+}
+
+/* _n_memo_d: kept %memo counters, since the last u3n_damp().
+ *
+ *   [0] road cache hits, [1] kept hits, [2] misses,
+ *   [3] results kept, [4] results too cheap to keep,
+ *   [5] kept results evicted, [6] kept results promoted.
+ */
+static c3_d _n_memo_d[7];
+
+// results cheaper than this (in microseconds) are not kept
+#define MEMO_COST 100
+
+/* _n_memo_on(): yes iff %memo results are kept on this road.
+ *
+ *   a road inside a namespace (see u3m_soft_run()) may scry,
+ *   so its results are not pure, and must die with it.
+ */
+static inline c3_o
+_n_memo_on(void)
+{
+  return __( (u3C.wag_w & u3o_memo_keep) && (u3_nul == u3R->ski.gul) );
+}
+
+/* _n_memo_time(): memo stamp, monotonic microseconds (mod 2^31).
+ */
+static inline u3_atom
+_n_memo_time(void)
+{
+  return (u3_atom)((_n_prof_time() / 1000ULL) & 0x7fffffff);
+}
+
+/* _n_memo_cull_u: state for _n_memo_cull().
+ */
+typedef struct {
+  c3_w          his_w[32];              //  entries by log2 score
+  c3_w          cut_w;                  //  evict below this log2 score
+  c3_w          lef_w;                  //  ... and this many at it
+  u3p(u3h_root) har_p;                  //  survivors
+} _n_memo_cull_u;
+
+/* _n_memo_count(): u3h_walk_with helper, histogram scores.
+ */
+static void
+_n_memo_count(u3_noun kev, void* wit)
+{
+  _n_memo_cull_u* cul_u = wit;
+
+  cul_u->his_w[c3_bits_word(u3h(u3t(u3t(kev))))]++;
+}
+
+/* _n_memo_keep(): u3h_walk_with helper, copy out survivors.
+ */
+static void
+_n_memo_keep(u3_noun kev, void* wit)
+{
+  _n_memo_cull_u* cul_u = wit;
+  u3_noun         key, cos, sco, pro;
+  c3_w            bit_w;
+
+  u3x_qual(kev, &key, &cos, &sco, &pro);
+  bit_w = c3_bits_word(sco);
+
+  if (  (bit_w < cul_u->cut_w)
+     || ((bit_w == cul_u->cut_w) && cul_u->lef_w && cul_u->lef_w--) )
+  {
+    _n_memo_d[5]++;
+    return;
+  }
+
+  u3h_put(cul_u->har_p, key, u3nt(cos, c3_max(1, sco >> 1), u3k(pro)));
+}
+
+/* _n_memo_cull(): evict the lowest-scoring quarter of a full table.
+ *
+ *   entries are [cos sco pro]: [cos] is the measured cost of the
+ *   computation, and [sco] its score, raised by [cos] on every hit
+ *   and halved for the survivors of every cull, so that expensive
+ *   and popular results outlive cheap or stale ones.
+ */
+static void
+_n_memo_cull(u3p(u3h_root)* har_p)
+{
+  _n_memo_cull_u cul_u;
+  c3_w           use_w = u3to(u3h_root, *har_p)->use_w;
+  c3_w           evi_w = c3_max(1, use_w >> 2);
+  c3_w           sum_w = 0;
+
+  memset(&cul_u, 0, sizeof(cul_u));
+  u3h_walk_with(*har_p, _n_memo_count, &cul_u);
+
+  while (  (cul_u.cut_w < 31)
+        && ((sum_w + cul_u.his_w[cul_u.cut_w]) < evi_w) )
+  {
+    sum_w += cul_u.his_w[cul_u.cut_w++];
+  }
+
+  cul_u.lef_w = evi_w - sum_w;
+  cul_u.har_p = u3h_new();
+  u3h_walk_with(*har_p, _n_memo_keep, &cul_u);
+  u3h_free(*har_p);
+  *har_p = cul_u.har_p;
+}
+
+/* _n_memo_put(): keep [cos sco pro] at [key], bounded by -C.
+ *                RETAIN key, TRANSFER val.
+ */
+static void
+_n_memo_put(u3p(u3h_root)* har_p, u3_noun key, u3_noun val)
+{
+  if ( !*har_p ) {
+    *har_p = u3h_new();
+  }
+  else if (  u3_Host.ops_u.hap_w
+          && (u3to(u3h_root, *har_p)->use_w >= u3_Host.ops_u.hap_w) )
+  {
+    _n_memo_cull(har_p);
+  }
+
+  u3h_put(*har_p, key, val);
+}
+
+/* _n_memo_save(): keep a %memo result, if it was expensive enough.
+ *                 RETAIN.
+ */
+static void
+_n_memo_save(u3_noun key, u3_atom tim, u3_noun pro)
+{
+  c3_w cos_w = (_n_memo_time() - tim) & 0x7fffffff;
+
+  if ( cos_w < MEMO_COST ) {
+    _n_memo_d[4]++;
+  }
+  else {
+    _n_memo_d[3]++;
+    _n_memo_put(&(u3R->mem.har_p), key, u3nt(cos_w, cos_w, u3k(pro)));
+  }
+}
+
+/* _n_memo_find(): find a kept %memo result on this road or above,
+ *                 and credit it with a hit on this road.  RETAIN.
+ *
+ *   a hit on a senior result is recorded here at its bare cost,
+ *   and summed into the senior score by u3n_memo_reap().
+ */
+static u3_weak
+_n_memo_find(u3_noun key)
+{
+  u3a_road* rod_u = u3R;
+  u3_noun   cos, sco, pro;
+  u3_weak   got;
+
+  while ( 1 ) {
+    if (  rod_u->mem.har_p
+       && (u3_none != (got = u3h_git(rod_u->mem.har_p, key))) )
+    {
+      break;
+    }
+    else if ( !rod_u->par_p ) {
+      return u3_none;
+    }
+
+    rod_u = u3to(u3a_road, rod_u->par_p);
+  }
+
+  _n_memo_d[1]++;
+  u3x_trel(got, &cos, &sco, &pro);
+  sco = ( rod_u == u3R ) ? c3_min(0x7fffffff, sco + cos) : cos;
+  pro = u3k(pro);
+  _n_memo_put(&(u3R->mem.har_p), key, u3nt(cos, sco, u3k(pro)));
+
+  return pro;
+}
 
 /* _n_apen(): emit the instructions contained in src to dst
  */
@@ -979,14 +1499,16 @@ _n_emit(u3_noun *ops, u3_noun op)
   *ops = u3nc(op, *ops);
 }
 
-static c3_w _n_comp(u3_noun*, u3_noun, c3_o, c3_o);
+static c3_w _n_comp(u3_noun*, u3_noun, u3_noun, c3_o, c3_o);
 
 /* _n_bint(): hint-processing helper for _n_comp.
  *            hif: hint-formula (first part of 11). RETAIN.
  *            nef: next-formula (second part of 11). RETAIN.
+ *            kno: subject knowledge (see _n_know()). RETAIN.
  */
 static c3_w
-_n_bint(u3_noun* ops, u3_noun hif, u3_noun nef, c3_o los_o, c3_o tel_o)
+_n_bint(u3_noun* ops, u3_noun hif, u3_noun nef, u3_noun kno,
+        c3_o los_o, c3_o tel_o)
 {
   c3_w tot_w = 0;
 
@@ -996,13 +1518,13 @@ _n_bint(u3_noun* ops, u3_noun hif, u3_noun nef, c3_o los_o, c3_o tel_o)
     //
     switch ( hif ) {
       default: {
-        return _n_comp(ops, nef, los_o, tel_o);
+        return _n_comp(ops, nef, kno, los_o, tel_o);
       }
       case c3__nara:
       case c3__hela:
       case c3__bout: {
         u3_noun fen = u3_nul;
-        c3_w  nef_w = _n_comp(&fen, nef, los_o, c3n);
+        c3_w  nef_w = _n_comp(&fen, nef, kno, los_o, c3n);
         // add appropriate hind opcode
         ++nef_w; _n_emit(&fen, ( c3y == los_o ) ? HILL : HILK);
         // skip over the cleanup opcode
@@ -1030,22 +1552,22 @@ _n_bint(u3_noun* ops, u3_noun hif, u3_noun nef, c3_o los_o, c3_o tel_o)
         //
         switch ( zep ) {
           default: {
-            tot_w += _n_comp(ops, hod, c3n, c3n);
+            tot_w += _n_comp(ops, hod, kno, c3n, c3n);
             ++tot_w; _n_emit(ops, TOSS);
-            tot_w += _n_comp(ops, nef, los_o, tel_o);
+            tot_w += _n_comp(ops, nef, kno, los_o, tel_o);
           } break;
           case c3__nara:
           case c3__hela:
           case c3__bout: {
             u3_noun fen = u3_nul;
-            c3_w  nef_w = _n_comp(&fen, nef, los_o, c3n);
+            c3_w  nef_w = _n_comp(&fen, nef, kno, los_o, c3n);
             // add appropriate hind opcode
             ++nef_w; _n_emit(&fen, ( c3y == los_o ) ? HINL : HINK);
             // skip over the cleanup opcode
             ++nef_w; _n_emit(&fen, u3nc(SBIP, 1));
 
             // push clue
-            tot_w += _n_comp(ops, hod, c3n, c3n);
+            tot_w += _n_comp(ops, hod, kno, c3n, c3n);
             //  call hint_fore
             //  HINB overflows to HINS
             ++tot_w; _n_emit(ops, u3nc(HINB, u3nc(u3k(zep), u3k(nef))));
@@ -1062,30 +1584,38 @@ _n_bint(u3_noun* ops, u3_noun hif, u3_noun nef, c3_o los_o, c3_o tel_o)
       case c3__lose:
       case c3__mean:
       case c3__spot:
-        tot_w += _n_comp(ops, hod, c3n, c3n);
-        ++tot_w; _n_emit(ops, u3nc(BUSH, zep)); // overflows to SUSH
-        tot_w += _n_comp(ops, nef, los_o, c3n);
+        //  constant clue: trace a literal, without allocating
+        //
+        if ( (c3y == u3du(hod)) && (1 == u3h(hod)) ) {
+          // overflows to TAXS
+          ++tot_w; _n_emit(ops, u3nc(TAXB, u3nc(u3k(zep), u3k(u3t(hod)))));
+        }
+        else {
+          tot_w += _n_comp(ops, hod, kno, c3n, c3n);
+          ++tot_w; _n_emit(ops, u3nc(BUSH, zep)); // overflows to SUSH
+        }
+        tot_w += _n_comp(ops, nef, kno, los_o, c3n);
         ++tot_w; _n_emit(ops, DROP);
         break;
 
       case c3__live:
-        tot_w += _n_comp(ops, hod, c3n, c3n);
+        tot_w += _n_comp(ops, hod, kno, c3n, c3n);
         ++tot_w; _n_emit(ops, HECK);
-        tot_w += _n_comp(ops, nef, los_o, tel_o);
+        tot_w += _n_comp(ops, nef, kno, los_o, tel_o);
         break;
 
       case c3__slog:
-        tot_w += _n_comp(ops, hod, c3n, c3n);
+        tot_w += _n_comp(ops, hod, kno, c3n, c3n);
         ++tot_w; _n_emit(ops, SLOG);
-        tot_w += _n_comp(ops, nef, los_o, tel_o);
+        tot_w += _n_comp(ops, nef, kno, los_o, tel_o);
         break;
 
       // germ and sole are unused...
 
       case c3__fast:
-        tot_w += _n_comp(ops, hod, c3n, c3n);
+        tot_w += _n_comp(ops, hod, kno, c3n, c3n);
         ++tot_w; _n_emit(ops, SWAP);
-        tot_w += _n_comp(ops, nef, c3n, c3n);
+        tot_w += _n_comp(ops, nef, kno, c3n, c3n);
         // overflows to SALT / SAST
         ++tot_w; _n_emit(ops, (c3y == los_o) ? BALT : BAST);
         break;
@@ -1096,11 +1626,11 @@ _n_bint(u3_noun* ops, u3_noun hif, u3_noun nef, c3_o los_o, c3_o tel_o)
         c3_y op_y;
 
         // we just throw away the hint (why is this not a static hint?)
-        tot_w += _n_comp(ops, hod, c3n, c3n);
+        tot_w += _n_comp(ops, hod, kno, c3n, c3n);
         ++tot_w; _n_emit(ops, TOSS);
 
         // memoizing code always loses TOS because SAVE needs [pro key]
-        mem_w += _n_comp(&mem, nef, c3y, c3n);
+        mem_w += _n_comp(&mem, nef, kno, c3y, c3n);
         ++mem_w; _n_emit(&mem, SAVE);
 
         op_y   = (c3y == los_o) ? SLIB : SKIB; // overflows to SLIS / SKIS
@@ -1176,42 +1706,426 @@ _n_formulaic(u3_noun fol)
   }
 }
 
-/* _n_comp(): compile nock formula to reversed opcode list
- *            ops is a pointer to a list (to be emitted to)
- *            fol is the nock formula to compile. RETAIN.
- *            los_o indicates whether we should remove our
- *                  subject from the stack
- *            tel_o is yes if this formula is in tail position
- *            return: number of instructions added to the opcode list
+/* subject knowledge: what the compiler can tell statically about a noun.
+ *
+ *   ~               nothing
+ *   [%& val]        the noun is val
+ *   [%| hed tal]    the noun is a cell, with knowledge of each side
+ *
+ * knowledge starts from nothing at the top of a formula, and grows
+ * from literals built into the subject by nock 7, 8 and autocons.
  */
-static c3_w
-_n_comp(u3_noun* ops, u3_noun fol, c3_o los_o, c3_o tel_o)
+
+/* _n_know_cons(): knowledge of a cell. TRANSFER.
+ */
+static u3_noun
+_n_know_cons(u3_noun hed, u3_noun tal)
 {
-  c3_y op_y;
-  c3_w tot_w = 0;
-  u3_noun cod, arg, hed, tel;
-  u3x_cell(fol, &cod, &arg);
-  if ( c3y == u3du(cod) ) {
-    tot_w += _n_comp(ops, cod, c3n, c3n);
-    ++tot_w; _n_emit(ops, SWAP);
-    tot_w += _n_comp(ops, arg, c3n, c3n);
-    ++tot_w; _n_emit(ops, (c3y == los_o ) ? AULT : AUTO);
+  if (  (c3y == u3du(hed)) && (c3y == u3h(hed))
+     && (c3y == u3du(tal)) && (c3y == u3h(tal)) )
+  {
+    u3_noun pro = u3nt(c3y, u3k(u3t(hed)), u3k(u3t(tal)));
+    u3z(hed); u3z(tal);
+    return pro;
   }
-  else switch ( cod ) {
-    case 0:
-      if ( c3n == u3ud(arg) ) {
-        u3m_bail(c3__exit);
-        return 0;
+  return u3nt(c3n, hed, tal);
+}
+
+/* _n_know_at(): knowledge of fragment axe_w of a noun. *tot_o is set
+ *               to yes if the fragment is known to exist. RETAIN.
+ */
+static u3_noun
+_n_know_at(c3_w axe_w, u3_noun kno, c3_o* tot_o)
+{
+  c3_w dep_w = c3_bits_word(axe_w) - 1;
+
+  *tot_o = c3n;
+
+  while ( dep_w ) {
+    if ( c3n == u3du(kno) ) {
+      return u3_nul;
+    }
+    else if ( c3y == u3h(kno) ) {
+      c3_w    sub_w = (axe_w & ((1 << dep_w) - 1)) | (1 << dep_w);
+      u3_weak val   = u3r_at(sub_w, u3t(kno));
+
+      if ( u3_none == val ) {
+        return u3_nul;
       }
-      switch ( arg ) {
-        case 0:
-          ++tot_w; _n_emit(ops, BAIL);
-          break;
-        case 1:
-          if ( c3n == los_o ) {
-            ++tot_w; _n_emit(ops, COPY);
-          }
-          break;
+      *tot_o = c3y;
+      return u3nc(c3y, u3k(val));
+    }
+    else {
+      dep_w--;
+      kno = ( 1 & (axe_w >> dep_w) ) ? u3t(u3t(kno)) : u3h(u3t(kno));
+    }
+  }
+
+  *tot_o = c3y;
+  return u3k(kno);
+}
+
+/* _n_know_edit(): knowledge of a noun after editing axe_w to val.
+ *                 val is TRANSFERRED, kno is RETAINED.
+ */
+static u3_noun
+_n_know_edit(c3_w axe_w, u3_noun val, u3_noun kno)
+{
+  if ( 1 == axe_w ) {
+    return val;
+  }
+  else {
+    c3_w    dep_w = c3_bits_word(axe_w) - 2,
+            sub_w = (axe_w & ((1 << dep_w) - 1)) | (1 << dep_w);
+    u3_noun hed, tal, pro;
+
+    if ( c3n == u3du(kno) ) {
+      hed = tal = u3_nul;
+    }
+    else if ( c3y == u3h(kno) ) {
+      if ( c3n == u3du(u3t(kno)) ) {
+        //  editing an atom fails; anything may be claimed
+        //
+        u3z(val);
+        return u3_nul;
+      }
+      hed = u3nc(c3y, u3k(u3h(u3t(kno))));
+      tal = u3nc(c3y, u3k(u3t(u3t(kno))));
+    }
+    else {
+      hed = u3k(u3h(u3t(kno)));
+      tal = u3k(u3t(u3t(kno)));
+    }
+
+    if ( 1 & (axe_w >> dep_w) ) {
+      pro = _n_know_edit(sub_w, val, tal);
+      u3z(tal);
+      return _n_know_cons(hed, pro);
+    }
+    else {
+      pro = _n_know_edit(sub_w, val, hed);
+      u3z(hed);
+      return _n_know_cons(pro, tal);
+    }
+  }
+}
+
+/* _n_know(): knowledge of the product of fol, given knowledge kno of
+ *            its subject. *tot_o is set to yes if the product is
+ *            also known to be computed without crash or effect.
+ *            RETAIN.
+ */
+static u3_noun
+_n_know(u3_noun kno, u3_noun fol, c3_o* tot_o, c3_w dep_w)
+{
+  u3_noun hed, tel;
+
+  *tot_o = c3n;
+
+  //  bound the analysis on deeply nested subject formulas
+  //
+  if ( (c3n == u3du(fol)) || (dep_w > 32) ) {
+    return u3_nul;
+  }
+
+  hed = u3h(fol);
+  tel = u3t(fol);
+
+  if ( c3y == u3du(hed) ) {
+    c3_o    hot_o, lot_o;
+    u3_noun pro = _n_know_cons(_n_know(kno, hed, &hot_o, dep_w + 1),
+                               _n_know(kno, tel, &lot_o, dep_w + 1));
+    *tot_o = c3a(hot_o, lot_o);
+    return pro;
+  }
+
+  switch ( hed ) {
+    default:
+      return u3_nul;
+
+    case 0:
+      if ( (c3n == u3a_is_cat(tel)) || (0 == tel) ) {
+        return u3_nul;
+      }
+      return _n_know_at(tel, kno, tot_o);
+
+    case 1:
+      *tot_o = c3y;
+      return u3nc(c3y, u3k(tel));
+
+    case 7:
+    case 8: {
+      c3_o    hot_o, lot_o;
+      u3_noun kot, pro;
+
+      if ( c3n == u3du(tel) ) {
+        return u3_nul;
+      }
+
+      kot = _n_know(kno, u3h(tel), &hot_o, dep_w + 1);
+      if ( 8 == hed ) {
+        kot = _n_know_cons(kot, u3k(kno));
+      }
+      pro = _n_know(kot, u3t(tel), &lot_o, dep_w + 1);
+      u3z(kot);
+      *tot_o = c3a(hot_o, lot_o);
+      return pro;
+    }
+
+    //  edits are never total: the edited axis may not exist
+    //
+    case 10: {
+      c3_o    hot_o, lot_o;
+      u3_noun axe, val, kot, pro;
+
+      if (  (c3n == u3du(tel)) || (c3n == u3du(u3h(tel)))
+         || (c3n == u3a_is_cat(axe = u3h(u3h(tel)))) || (0 == axe) )
+      {
+        return u3_nul;
+      }
+
+      val = _n_know(kno, u3t(u3h(tel)), &hot_o, dep_w + 1);
+      kot = _n_know(kno, u3t(tel), &lot_o, dep_w + 1);
+      pro = _n_know_edit(axe, val, kot);
+      u3z(kot);
+      return pro;
+    }
+  }
+}
+
+/* transient cells: a cell built by autocons or nock 8 as the subject
+ * of a body that only reads one side of it never escapes, and need
+ * not be allocated. the body is rebased onto that side, and the
+ * other side is computed (for its crashes and effects) and dropped.
+ *
+ * a body escapes its subject if it reads axis 1 of it, directly or
+ * under nested nock 8 pushes, or if the analysis runs out of budget.
+ */
+
+/* _n_rebase_axe(): axe of a subject under dep_w pushes, rebased onto
+ *                  side *sid_y (2 or 3, or 0 if not yet chosen), or
+ *                  u3_none if it escapes. RETAIN.
+ */
+static u3_noun
+_n_rebase_axe(u3_atom axe, c3_w dep_w, c3_y* sid_y)
+{
+  u3_noun mas, pro;
+
+  if ( 1 == axe ) {
+    return u3_none;
+  }
+  else if ( 0 == dep_w ) {
+    c3_y cap_y = (c3_y)u3qc_cap(axe);
+
+    if ( *sid_y && (cap_y != *sid_y) ) {
+      return u3_none;
+    }
+    *sid_y = cap_y;
+    return u3qc_mas(axe);
+  }
+  else if ( 2 == u3qc_cap(axe) ) {
+    return u3k(axe);
+  }
+
+  mas = u3qc_mas(axe);
+  pro = _n_rebase_axe(mas, dep_w - 1, sid_y);
+  u3z(mas);
+
+  if ( u3_none != pro ) {
+    mas = pro;
+    pro = u3qc_peg(3, mas);
+    u3z(mas);
+  }
+  return pro;
+}
+
+static u3_noun
+_n_rebase(u3_noun fol, c3_w dep_w, c3_y* sid_y, c3_w* bud_w);
+
+/* _n_rebase_two(): rebase a pair of formulas, or u3_none. RETAIN.
+ */
+static u3_noun
+_n_rebase_two(u3_noun hed,
+              c3_w    hed_w,
+              u3_noun tel,
+              c3_w    tel_w,
+              c3_y*   sid_y,
+              c3_w*   bud_w)
+{
+  u3_noun heb, teb;
+
+  if ( u3_none == (heb = _n_rebase(hed, hed_w, sid_y, bud_w)) ) {
+    return u3_none;
+  }
+  if ( u3_none == (teb = _n_rebase(tel, tel_w, sid_y, bud_w)) ) {
+    u3z(heb);
+    return u3_none;
+  }
+  return u3nc(heb, teb);
+}
+
+/* _n_rebase(): fol, run against a subject under dep_w nock 8 pushes,
+ *              rewritten to run against side *sid_y of that subject
+ *              (see _n_rebase_axe()), or u3_none if the subject
+ *              escapes. malformed formulas escape, and are left for
+ *              _n_comp() to reject. RETAIN.
+ */
+static u3_noun
+_n_rebase(u3_noun fol, c3_w dep_w, c3_y* sid_y, c3_w* bud_w)
+{
+  u3_noun cod, arg, hed, tel, pro;
+
+  if ( (c3n == u3du(fol)) || (0 == *bud_w) ) {
+    return u3_none;
+  }
+
+  --*bud_w;
+  cod = u3h(fol);
+  arg = u3t(fol);
+
+  if ( c3y == u3du(cod) ) {
+    return _n_rebase_two(cod, dep_w, arg, dep_w, sid_y, bud_w);
+  }
+
+  switch ( cod ) {
+    default:
+      return u3_none;
+
+    case 0:
+      if ( c3n == u3ud(arg) ) {
+        return u3_none;
+      }
+      else if ( 0 == arg ) {
+        return u3k(fol);
+      }
+      pro = _n_rebase_axe(arg, dep_w, sid_y);
+      return ( u3_none == pro ) ? pro : u3nc(0, pro);
+
+    case 1:
+      return u3k(fol);
+
+    case 3: case 4:
+      pro = _n_rebase(arg, dep_w, sid_y, bud_w);
+      return ( u3_none == pro ) ? pro : u3nc(cod, pro);
+
+    case 2: case 5: case 6: case 12:
+      if ( c3n == u3du(arg) ) {
+        return u3_none;
+      }
+      pro = _n_rebase_two(u3h(arg), dep_w, u3t(arg), dep_w, sid_y, bud_w);
+      return ( u3_none == pro ) ? pro : u3nc(cod, pro);
+
+    case 7:
+      if ( c3n == u3du(arg) ) {
+        return u3_none;
+      }
+      pro = _n_rebase(u3h(arg), dep_w, sid_y, bud_w);
+      return ( u3_none == pro ) ? pro : u3nt(7, pro, u3k(u3t(arg)));
+
+    case 8:
+      if ( c3n == u3du(arg) ) {
+        return u3_none;
+      }
+      pro = _n_rebase_two(u3h(arg), dep_w, u3t(arg), dep_w + 1, sid_y, bud_w);
+      return ( u3_none == pro ) ? pro : u3nc(8, pro);
+
+    case 9:
+      if ( (c3n == u3du(arg)) || (c3n == u3ud(u3h(arg))) ) {
+        return u3_none;
+      }
+      pro = _n_rebase(u3t(arg), dep_w, sid_y, bud_w);
+      return ( u3_none == pro ) ? pro : u3nt(9, u3k(u3h(arg)), pro);
+
+    case 10:
+      if ( (c3n == u3du(arg)) || (c3n == u3du(hed = u3h(arg))) ) {
+        return u3_none;
+      }
+      tel = u3t(arg);
+      pro = _n_rebase_two(u3t(hed), dep_w, tel, dep_w, sid_y, bud_w);
+      if ( u3_none != pro ) {
+        u3_noun val = pro;
+        pro = u3nt(10, u3nc(u3k(u3h(hed)), u3k(u3h(val))), u3k(u3t(val)));
+        u3z(val);
+      }
+      return pro;
+
+    case 11:
+      if ( c3n == u3du(arg) ) {
+        return u3_none;
+      }
+      hed = u3h(arg);
+      tel = u3t(arg);
+      if ( c3n == u3du(hed) ) {
+        pro = _n_rebase(tel, dep_w, sid_y, bud_w);
+        return ( u3_none == pro ) ? pro : u3nt(11, u3k(hed), pro);
+      }
+      pro = _n_rebase_two(u3t(hed), dep_w, tel, dep_w, sid_y, bud_w);
+      if ( u3_none != pro ) {
+        u3_noun val = pro;
+        pro = u3nt(11, u3nc(u3k(u3h(hed)), u3k(u3h(val))), u3k(u3t(val)));
+        u3z(val);
+      }
+      return pro;
+  }
+}
+
+/* _n_transient(): body tel of a transient cell, rebased onto side
+ *                 *sid_y of it (3 if it reads neither), or u3_none.
+ *                 RETAIN.
+ */
+static u3_noun
+_n_transient(u3_noun tel, c3_y* sid_y)
+{
+  c3_w bud_w = 512;
+  u3_noun pro;
+
+  *sid_y = 0;
+  pro = _n_rebase(tel, 0, sid_y, &bud_w);
+
+  if ( 0 == *sid_y ) {
+    *sid_y = 3;
+  }
+  return pro;
+}
+
+/* _n_comp(): compile nock formula to reversed opcode list
+ *            ops is a pointer to a list (to be emitted to)
+ *            fol is the nock formula to compile. RETAIN.
+ *            kno is what is statically known of the subject
+ *                (see _n_know()). RETAIN.
+ *            los_o indicates whether we should remove our
+ *                  subject from the stack
+ *            tel_o is yes if this formula is in tail position
+ *            return: number of instructions added to the opcode list
+ */
+static c3_w
+_n_comp(u3_noun* ops, u3_noun fol, u3_noun kno, c3_o los_o, c3_o tel_o)
+{
+  c3_y op_y;
+  c3_w tot_w = 0;
+  u3_noun cod, arg, hed, tel;
+  u3x_cell(fol, &cod, &arg);
+  if ( c3y == u3du(cod) ) {
+    tot_w += _n_comp(ops, cod, kno, c3n, c3n);
+    ++tot_w; _n_emit(ops, SWAP);
+    tot_w += _n_comp(ops, arg, kno, c3n, c3n);
+    ++tot_w; _n_emit(ops, (c3y == los_o ) ? AULT : AUTO);
+  }
+  else switch ( cod ) {
+    case 0:
+      if ( c3n == u3ud(arg) ) {
+        u3m_bail(c3__exit);
+        return 0;
+      }
+      switch ( arg ) {
+        case 0:
+          ++tot_w; _n_emit(ops, BAIL);
+          break;
+        case 1:
+          if ( c3n == los_o ) {
+            ++tot_w; _n_emit(ops, COPY);
+          }
+          break;
         case 2:
           ++tot_w; _n_emit(ops, (c3y == los_o) ? HELD : HEAD);
           break;
@@ -1244,25 +2158,41 @@ _n_comp(u3_noun* ops, u3_noun fol, c3_o los_o, c3_o tel_o)
       }
       break;
 
-    case 2:
+    case 2: {
+      c3_o    tot_o;
+      u3_noun fok;
       u3x_cell(arg, &hed, &tel);
-      tot_w += _n_comp(ops, hed, c3n, c3n);
-      ++tot_w; _n_emit(ops, SWAP);
-      tot_w += _n_comp(ops, tel, c3n, c3n);
-      /* things in tail position replace (so, lose) top of stack,
-       * so NOCT "loses" and there is no non-losing version */
-      op_y   = (c3y == tel_o)  ? NOCT
-             : ((c3y == los_o) ? NOLK : NOCK);
-      ++tot_w; _n_emit(ops, op_y);
+      fok = _n_know(kno, tel, &tot_o, 0);
+
+      //  a formula known statically (and computed without effects)
+      //  is called directly, its program cached in a call site
+      //
+      if ( (c3y == tot_o) && (c3y == u3du(fok)) && (c3y == u3h(fok)) ) {
+        tot_w += _n_comp(ops, hed, kno, (c3y == tel_o ? c3y : los_o), c3n);
+        op_y = (c3y == tel_o) ? DITB : DIRB; // overflows to DITS/DIRS
+        ++tot_w; _n_emit(ops, u3nc(op_y, u3k(u3t(fok))));
+      }
+      else {
+        tot_w += _n_comp(ops, hed, kno, c3n, c3n);
+        ++tot_w; _n_emit(ops, SWAP);
+        tot_w += _n_comp(ops, tel, kno, c3n, c3n);
+        /* things in tail position replace (so, lose) top of stack,
+         * so NOCT "loses" and there is no non-losing version */
+        op_y   = (c3y == tel_o)  ? NOCT
+               : ((c3y == los_o) ? NOLK : NOCK);
+        ++tot_w; _n_emit(ops, op_y);
+      }
+      u3z(fok);
       break;
+    }
 
     case 3:
-      tot_w += _n_comp(ops, arg, los_o, c3n);
+      tot_w += _n_comp(ops, arg, kno, los_o, c3n);
       ++tot_w; _n_emit(ops, DEEP);
       break;
 
     case 4:
-      tot_w += _n_comp(ops, arg, los_o, c3n);
+      tot_w += _n_comp(ops, arg, kno, los_o, c3n);
       ++tot_w; _n_emit(ops, BUMP);
       break;
 
@@ -1292,13 +2222,13 @@ _n_comp(u3_noun* ops, u3_noun fol, c3_o los_o, c3_o tel_o)
           }
         }
         else if ( !hec_t && !tec_t ) {
-          tot_w += _n_comp(ops, hed, c3n, c3n);
+          tot_w += _n_comp(ops, hed, kno, c3n, c3n);
           ++tot_w; _n_emit(ops, SWAP);
-          tot_w += _n_comp(ops, tel, c3n, c3n);
+          tot_w += _n_comp(ops, tel, kno, c3n, c3n);
           ++tot_w; _n_emit(ops, (c3y == los_o) ? SALM : SAME);
         }
         else {
-          tot_w += _n_comp(ops, (hec_t ? tel : hed), los_o, c3n);
+          tot_w += _n_comp(ops, (hec_t ? tel : hed), kno, los_o, c3n);
           u3_noun lit = u3t(hec_t ? hed : tel);
           switch ( lit ) {
             case 0:
@@ -1325,7 +2255,7 @@ _n_comp(u3_noun* ops, u3_noun fol, c3_o los_o, c3_o tel_o)
       c3_t    yep_t, nop_t;
       u3x_trel(arg, &hed, &mid, &tel);
 
-      tot_w += _n_comp(ops, hed, c3n, c3n);
+      tot_w += _n_comp(ops, hed, kno, c3n, c3n);
       yep_t = _n_formulaic(mid);
       nop_t = _n_formulaic(tel);
 
@@ -1335,14 +2265,14 @@ _n_comp(u3_noun* ops, u3_noun fol, c3_o los_o, c3_o tel_o)
       }
 
       if ( yep_t ) {
-        yep_w = _n_comp(&yep, mid, los_o, tel_o);
+        yep_w = _n_comp(&yep, mid, kno, los_o, tel_o);
       }
       else {
         yep_w = 1; _n_emit(&yep, BAIL);
       }
 
       if ( nop_t ) {
-        nop_w = _n_comp(&nop, tel, los_o, tel_o);
+        nop_w = _n_comp(&nop, tel, kno, los_o, tel_o);
       }
       else {
         nop_w = 1; _n_emit(&nop, BAIL);
@@ -1358,26 +2288,105 @@ _n_comp(u3_noun* ops, u3_noun fol, c3_o los_o, c3_o tel_o)
 
     case 7:
       u3x_cell(arg, &hed, &tel);
-      tot_w += _n_comp(ops, hed, los_o, c3n);
-      tot_w += _n_comp(ops, tel, c3y, tel_o);
+      //  compose fragment chains statically: [7 [0 a] 0 b] is [0 (peg a b)]
+      //
+      if (  (c3y == u3du(hed)) && (0 == u3h(hed)) && (c3y == u3ud(u3t(hed)))
+         && (c3y == u3du(tel)) && (0 == u3h(tel)) && (c3y == u3ud(u3t(tel)))
+         && (0 != u3t(hed)) && (0 != u3t(tel)) )
+      {
+        u3_noun fag = u3nc(0, u3qc_peg(u3t(hed), u3t(tel)));
+        tot_w += _n_comp(ops, fag, kno, los_o, tel_o);
+        u3z(fag);
+        break;
+      }
+      //  [7 [a b] c], where c reads one side of [a b]: no cell
+      //
+      if ( (c3y == u3du(hed)) && (c3y == u3du(u3h(hed))) ) {
+        c3_y    sid_y;
+        u3_noun bod = _n_transient(tel, &sid_y);
+
+        if ( u3_none != bod ) {
+          u3_noun fir = u3h(hed),
+                  sec = u3t(hed);
+
+          if ( 3 == sid_y ) {
+            u3_noun mac = u3nt(7, u3k(sec), bod);
+            tot_w += _n_comp(ops, fir, kno, c3n, c3n);
+            ++tot_w; _n_emit(ops, TOSS);
+            tot_w += _n_comp(ops, mac, kno, los_o, tel_o);
+            u3z(mac);
+          }
+          else if ( (c3y == u3du(sec)) && (1 == u3h(sec)) ) {
+            u3_noun mac = u3nt(7, u3k(fir), bod);
+            tot_w += _n_comp(ops, mac, kno, los_o, tel_o);
+            u3z(mac);
+          }
+          else {
+            c3_o    tot_o;
+            u3_noun kot = _n_know(kno, fir, &tot_o, 0);
+            tot_w += _n_comp(ops, fir, kno, c3n, c3n);
+            ++tot_w; _n_emit(ops, SWAP);
+            tot_w += _n_comp(ops, sec, kno, los_o, c3n);
+            ++tot_w; _n_emit(ops, TOSS);
+            if ( c3n == los_o ) {
+              ++tot_w; _n_emit(ops, SWAP);
+            }
+            tot_w += _n_comp(ops, bod, kot, c3y, tel_o);
+            u3z(kot);
+            u3z(bod);
+          }
+          break;
+        }
+      }
+      {
+        c3_o    tot_o;
+        u3_noun kot = _n_know(kno, hed, &tot_o, 0);
+        tot_w += _n_comp(ops, hed, kno, los_o, c3n);
+        tot_w += _n_comp(ops, tel, kot, c3y, tel_o);
+        u3z(kot);
+      }
       break;
 
-    case 8:
+    case 8: {
+      c3_o    tot_o;
+      c3_y    sid_y;
+      u3_noun kot, bod;
       u3x_cell(arg, &hed, &tel);
-      tot_w += _n_comp(ops, hed, c3n, c3n);
+
+      //  [8 a b], where b reads one side of [a subject]: no cell
+      //
+      if ( u3_none != (bod = _n_transient(tel, &sid_y)) ) {
+        if ( 2 == sid_y ) {
+          u3_noun mac = u3nt(7, u3k(hed), bod);
+          tot_w += _n_comp(ops, mac, kno, los_o, tel_o);
+          u3z(mac);
+        }
+        else {
+          tot_w += _n_comp(ops, hed, kno, c3n, c3n);
+          ++tot_w; _n_emit(ops, TOSS);
+          tot_w += _n_comp(ops, bod, kno, los_o, tel_o);
+          u3z(bod);
+        }
+        break;
+      }
+
+      kot = _n_know_cons(_n_know(kno, hed, &tot_o, 0), u3k(kno));
+      tot_w += _n_comp(ops, hed, kno, c3n, c3n);
       ++tot_w; _n_emit(ops, (c3y == los_o) ? SNOL : SNOC);
-      tot_w += _n_comp(ops, tel, c3y, tel_o);
+      tot_w += _n_comp(ops, tel, kot, c3y, tel_o);
+      u3z(kot);
       break;
+    }
 
     case 9:
       u3x_cell(arg, &hed, &tel);
       if ( (1 == hed) || (3 == u3qc_cap(hed)) ) {
         u3_noun mac = u3nq(7, u3k(tel), 2, u3nt(u3nc(0, 1), 0, u3k(hed)));
-        tot_w += _n_comp(ops, mac, los_o, tel_o);
+        tot_w += _n_comp(ops, mac, kno, los_o, tel_o);
         u3z(mac);
       }
       else {
-        tot_w += _n_comp(ops, tel, (c3y == tel_o ? c3y : los_o), c3n);
+        tot_w += _n_comp(ops, tel, kno, (c3y == tel_o ? c3y : los_o), c3n);
         op_y = (c3y == tel_o) ? TICB : KICB; // overflows to TICS/KICS
         ++tot_w; _n_emit(ops, u3nc(op_y, u3k(hed)));
       }
@@ -1387,9 +2396,9 @@ _n_comp(u3_noun* ops, u3_noun fol, c3_o los_o, c3_o tel_o)
       u3_noun axe, nef;
       u3x_cell(arg, &hed, &tel);
       u3x_cell(hed, &axe, &nef);
-      tot_w += _n_comp(ops, tel, c3n, c3n);
+      tot_w += _n_comp(ops, tel, kno, c3n, c3n);
       ++tot_w; _n_emit(ops, SWAP);
-      tot_w += _n_comp(ops, nef, c3n, c3n);
+      tot_w += _n_comp(ops, nef, kno, c3n, c3n);
 
       ++tot_w;
       switch ( axe ) {
@@ -1417,14 +2426,14 @@ _n_comp(u3_noun* ops, u3_noun fol, c3_o los_o, c3_o tel_o)
 
     case 11:
       u3x_cell(arg, &hed, &tel);
-      tot_w += _n_bint(ops, hed, tel, los_o, tel_o);
+      tot_w += _n_bint(ops, hed, tel, kno, los_o, tel_o);
       break;
 
     case 12:
       u3x_cell(arg, &hed, &tel);
-      tot_w += _n_comp(ops, hed, c3n, c3n);
+      tot_w += _n_comp(ops, hed, kno, c3n, c3n);
       ++tot_w; _n_emit(ops, SWAP);
-      tot_w += _n_comp(ops, tel, c3n, c3n);
+      tot_w += _n_comp(ops, tel, kno, c3n, c3n);
       ++tot_w; _n_emit(ops, (c3y == los_o) ? WILS : WISH);
       break;
 
@@ -1435,48 +2444,342 @@ _n_comp(u3_noun* ops, u3_noun fol, c3_o los_o, c3_o tel_o)
   return tot_w;
 }
 
-/* _n_push(): push a noun onto the stack. RETAIN
- *            mov: -1 north, 1 south
- *            off: 0 north, -1 south
+/* _n_skip(): produce instruction-count skip of op (from _n_comp), if any.
  */
-static inline void
-_n_push(c3_ys mov, c3_ys off, u3_noun a)
+static c3_o
+_n_skip(u3_noun op, c3_l* sip_l)
 {
-  u3R->cap_p += mov;
-
-  //  XX stack sanity-check disabled for performance
-  //
-#if 0
-  if ( 0 == off ) {
-    if( !(u3R->cap_p > u3R->hat_p) ) {
-      u3m_bail(c3__meme);
-    }
-  }
-  else {
-    if( !(u3R->cap_p < u3R->hat_p) ) {
-      u3m_bail(c3__meme);
-    }
+  if ( c3n == u3du(op) ) {
+    return c3n;
   }
-#endif
 
-  u3_noun* p = u3to(u3_noun, u3R->cap_p + off);
-  *p = a;
+  switch ( u3h(op) ) {
+    default:
+      return c3n;
+
+    case SBIP: case SBIN:
+    case ZBIN: case DBIN:
+      *sip_l = u3t(op);
+      return c3y;
+
+    case SKIB: case SLIB:
+      *sip_l = u3h(u3t(op));
+      return c3y;
+  }
 }
 
-/* _n_peek(): pointer to noun at top of stack
- *            off: 0 north, -1 south
+/* _n_fusion(): superinstruction for adjacent ops, or HALT if none.
+ *
+ *   the pairs below dominate the dynamic pair census (see u3n_damp()):
+ *   null and cell tests feeding a branch (?~, ?@, ?^), kicks
+ *   of the subject itself, and literals pinned onto the subject.
  */
-static inline u3_noun*
-_n_peek(c3_ys off)
+static c3_y
+_n_fusion(u3_noun one, u3_noun two)
 {
-  return u3to(u3_noun, u3R->cap_p + off);
-}
+  c3_y one_y = ( c3y == u3du(one) ) ? u3h(one) : one;
+  c3_y two_y = ( c3y == u3du(two) ) ? u3h(two) : two;
 
-/* _n_peet(): address of the next-to-top of stack
- *            mov: -1 north, 1 south
- *            off: 0 north, -1 south
- */
-static inline u3_noun*
+  switch ( two_y ) {
+    default:
+      return HALT;
+
+    case SBIN:
+      return ( SAM0 == one_y ) ? ZBIN
+           : ( DEEP == one_y ) ? DBIN
+           : HALT;
+
+    case KICB:
+      return ( COPY == one_y ) ? KOPB : HALT;
+
+    case SNOC:
+    case SNOL: {
+      switch ( one_y ) {
+        default:
+          return HALT;
+
+        case LIT0: case LIT1:
+        case LITB: case LITS: case LIBK:
+          return ( SNOC == two_y ) ? PINB : PILB;
+      }
+    }
+  }
+}
+
+/* _n_elide_d: refcount elisions by pattern, since the last u3n_damp().
+**
+**   [0] copy/toss, [1] literal/toss, [2] copy/lose-variant.
+**   each elided pair saves one u3a_gain() and one u3a_lose()
+**   every time the rewritten instruction runs.
+*/
+static c3_d _n_elide_d[3];
+
+/* _n_elision(): rewrite a pair of ops whose reference counting cancels
+ *               out, or c3n. *out is the replacement op, or u3_none if
+ *               the pair vanishes. the pattern is stored in *pat_w.
+ *
+ *   a COPY gains the top of the stack, and an immediately following
+ *   lose-variant (or TOSS) loses it again; a literal immediately tossed
+ *   is gained and lost for nothing. ops which can crash (fragments,
+ *   heads) are never removed, only rewritten into their keep-variants.
+ */
+static c3_o
+_n_elision(u3_noun one, u3_noun two, u3_weak* out, c3_w* pat_w)
+{
+  c3_y one_y = ( c3y == u3du(one) ) ? u3h(one) : one;
+  c3_y two_y = ( c3y == u3du(two) ) ? u3h(two) : two;
+
+  switch ( one_y ) {
+    default:
+      return c3n;
+
+    case LIT0: case LIT1:
+    case LITB: case LITS: case LIBK: {
+      if ( TOSS != two_y ) {
+        return c3n;
+      }
+
+      *out   = u3_none;
+      *pat_w = 1;
+      return c3y;
+    }
+
+    case COPY: {
+      c3_y cod_y;
+
+      switch ( two_y ) {
+        default:
+          return c3n;
+
+        case TOSS: {
+          *out   = u3_none;
+          *pat_w = 0;
+          return c3y;
+        }
+
+        case HELD: cod_y = HEAD; break;
+        case TALL: cod_y = TAIL; break;
+        case FABL: cod_y = FABK; break;
+        case FASL: cod_y = FASK; break;
+        case FIBL: cod_y = FIBK; break;
+        case LIL0: cod_y = LIT0; break;
+        case LIL1: cod_y = LIT1; break;
+        case LILB: cod_y = LITB; break;
+        case LILS: cod_y = LITS; break;
+        case LIBL: cod_y = LIBK; break;
+      }
+
+      *out   = ( c3y == u3du(two) ) ? u3nc(cod_y, u3k(u3t(two))) : cod_y;
+      *pat_w = 2;
+      return c3y;
+    }
+  }
+}
+
+/* _n_peep(): peephole rewrite of adjacent ops, or c3n. *out is
+ *            the replacement op, or u3_none if the pair vanishes.
+ */
+static c3_o
+_n_peep(u3_noun one, u3_noun two, u3_weak* out)
+{
+  c3_y    cod_y = _n_fusion(one, two);
+  u3_weak op;
+  c3_w    pat_w;
+
+  if ( HALT == cod_y ) {
+    if ( c3n == _n_elision(one, two, &op, &pat_w) ) {
+      return c3n;
+    }
+
+    _n_elide_d[pat_w]++;
+    *out = op;
+    return c3y;
+  }
+
+  switch ( cod_y ) {
+    default:
+      c3_assert(0);
+      break;
+
+    case ZBIN: case DBIN:
+      op = u3nc(cod_y, u3k(u3t(two)));
+      break;
+
+    case KOPB:
+      op = u3nc(cod_y, u3k(u3t(two)));
+      break;
+
+    case PINB: case PILB:
+      op = u3nc(cod_y, ( LIT0 == one ) ? 0
+                     : ( LIT1 == one ) ? 1
+                     : u3k(u3t(one)));
+      break;
+  }
+
+  *out = op;
+  return c3y;
+}
+
+/* _n_fuse(): peephole pass combining adjacent ops into superinstructions,
+ *            and eliding balanced refcount pairs (see _n_elision()).
+ *            ops is a reversed opcode list from _n_comp(). TRANSFER.
+ *
+ *   a pair is never rewritten if its second op is the target of a skip,
+ *   and all skips are recomputed against the rewritten instruction stream.
+ *   a skip to the first op of a vanished pair lands on whatever follows it.
+ */
+static u3_noun
+_n_fuse(u3_noun ops)
+{
+  c3_w     len_w = u3qb_lent(ops),
+           i_w, j_w;
+  u3_noun* fol   = u3a_malloc(sizeof(u3_noun) * (len_w + 1));
+  c3_w*    nex_w = u3a_malloc(sizeof(c3_w) * (len_w + 1));
+  c3_y*    tar_y = u3a_malloc(len_w + 1);
+  c3_y*    par_y = u3a_malloc(len_w + 1);
+  u3_noun  pro   = u3_nul;
+  c3_l     sip_l;
+
+  //  unreverse, and mark the targets of all skips
+  //
+  {
+    u3_noun lis = ops;
+
+    memset(tar_y, 0, len_w + 1);
+    memset(par_y, 0, len_w + 1);
+    i_w = len_w;
+
+    while ( u3_nul != lis ) {
+      fol[--i_w] = u3h(lis);
+      lis        = u3t(lis);
+    }
+
+    for ( i_w = 0; i_w < len_w; i_w++ ) {
+      if ( c3y == _n_skip(fol[i_w], &sip_l) ) {
+        tar_y[i_w + 1 + sip_l] = 1;
+      }
+    }
+  }
+
+  //  number the rewritten instruction stream, marking rewritten pairs
+  //
+  for ( i_w = 0, j_w = 0; i_w < len_w; ) {
+    u3_weak op;
+
+    nex_w[i_w] = j_w;
+
+    if (  ((i_w + 1) < len_w)
+       && !tar_y[i_w + 1]
+       && (c3y == _n_peep(fol[i_w], fol[i_w + 1], &op)) )
+    {
+      par_y[i_w]   = 1;
+      nex_w[++i_w] = j_w;
+      fol[i_w]     = op;
+
+      if ( u3_none != op ) {
+        j_w++;
+      }
+    }
+    else {
+      j_w++;
+    }
+
+    i_w++;
+  }
+  nex_w[len_w] = j_w;
+
+  //  emit (reversed), recomputing skips
+  //
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    u3_noun op;
+
+    if ( par_y[i_w] ) {
+      if ( u3_none == (op = fol[++i_w]) ) {
+        continue;
+      }
+    }
+    else {
+      op = u3k(fol[i_w]);
+    }
+
+    if ( c3y == _n_skip(op, &sip_l) ) {
+      c3_l new_l = nex_w[i_w + 1 + sip_l] - nex_w[i_w] - 1;
+
+      if ( new_l != sip_l ) {
+        u3_noun neo = ( (SKIB == u3h(op)) || (SLIB == u3h(op)) )
+                    ? u3nt(u3h(op), new_l, u3k(u3t(u3t(op))))
+                    : u3nc(u3h(op), new_l);
+        u3z(op);
+        op = neo;
+      }
+    }
+
+    pro = u3nc(op, pro);
+  }
+
+  u3a_free(par_y);
+  u3a_free(tar_y);
+  u3a_free(nex_w);
+  u3a_free(fol);
+  u3z(ops);
+
+  return pro;
+}
+
+/* _n_push(): push a noun onto the stack. RETAIN
+ *            mov: -1 north, 1 south
+ *            off: 0 north, -1 south
+ */
+static inline void
+_n_push(c3_ys mov, c3_ys off, u3_noun a)
+{
+  u3R->cap_p += mov;
+
+  //  unchecked: room is checked on program entry (see _n_room())
+  //
+  u3_noun* p = u3to(u3_noun, u3R->cap_p + off);
+  *p = a;
+}
+
+/* _n_room(): bail if the stack can't grow by pog_u's height bound.
+ *            off: 0 north, -1 south
+ *
+ *   checked once per program entry, in place of every push; the
+ *   bound includes the frame of any call the program makes.  (The
+ *   heap can still grow into the room while the program runs, but
+ *   runaway recursion, which enters a program per level, is caught.)
+ */
+static inline void
+_n_room(u3n_prog* pog_u, c3_ys off)
+{
+  c3_w hig_w = pog_u->byc_u.hig_w;
+
+  if ( 0 == off ) {
+    if ( (u3R->cap_p - u3R->hat_p) <= hig_w ) {
+      u3m_bail(c3__meme);
+    }
+  }
+  else {
+    if ( (u3R->hat_p - u3R->cap_p) <= hig_w ) {
+      u3m_bail(c3__meme);
+    }
+  }
+}
+
+/* _n_peek(): pointer to noun at top of stack
+ *            off: 0 north, -1 south
+ */
+static inline u3_noun*
+_n_peek(c3_ys off)
+{
+  return u3to(u3_noun, u3R->cap_p + off);
+}
+
+/* _n_peet(): address of the next-to-top of stack
+ *            mov: -1 north, 1 south
+ *            off: 0 north, -1 south
+ */
+static inline u3_noun*
 _n_peet(c3_ys mov, c3_ys off)
 {
   return u3to(u3_noun, (u3R->cap_p - mov) + off);
@@ -1603,8 +2906,8 @@ _n_print_byc(c3_y* pog, c3_w her_w)
 static inline u3n_prog*
 _n_bite(u3_noun fol) {
   u3_noun ops  = u3_nul;
-  _n_comp(&ops, fol, c3y, c3y);
-  return _n_prog_from_ops(ops);
+  _n_comp(&ops, fol, u3_nul, c3y, c3y);
+  return _n_prog_from_ops(_n_fuse(ops));
 }
 
 /* _n_find(): return prog for given formula with prefix (u3_nul for none).
@@ -1633,9 +2936,13 @@ _n_find(u3_noun pre, u3_noun fol)
         }
         for ( i_w = 0; i_w < old->cal_u.len_w; ++i_w ) {
           u3j_site* sit_u = &(old->cal_u.sit_u[i_w]);
-          sit_u->bat   = u3_none;
+          c3_w      j_w;
+
           sit_u->pog_p = 0;
-          sit_u->fon_o = c3n;
+          for ( j_w = 0; j_w < u3j_site_ways; ++j_w ) {
+            sit_u->lin_u[j_w].pog_p = 0;
+            sit_u->lin_u[j_w].fon_o = c3n;
+          }
         }
         u3h_put(u3R->byc.har_p, key, u3a_outa(old));
         u3z(key);
@@ -1646,6 +2953,7 @@ _n_find(u3_noun pre, u3_noun fol)
 
   {
     u3n_prog* gop = _n_bite(fol);
+    gop->mug_l    = u3r_mug(fol);
     u3h_put(u3R->byc.har_p, key, u3a_outa(gop));
     u3z(key);
     return gop;
@@ -1827,6 +3135,18 @@ _n_kick(u3_noun cor, u3j_site* sit_u)
   return pro;
 }
 
+/* _n_dire(): find the program of a direct call site (see DIRB),
+ *            whose axe is the statically known formula.
+ */
+static inline u3n_prog*
+_n_dire(u3j_site* sit_u)
+{
+  if ( 0 == sit_u->pog_p ) {
+    sit_u->pog_p = u3of(u3n_prog, _n_find(u3_nul, sit_u->axe));
+  }
+  return u3to(u3n_prog, sit_u->pog_p);
+}
+
 /* _n_kale(): bail(exit) if not cell
  */
 static inline u3_noun
@@ -1838,10 +3158,120 @@ _n_kale(u3_noun a)
   return a;
 }
 
-typedef struct {
-  u3n_prog* pog_u;
-  c3_w     ip_w;
-} burnframe;
+/* _n_memo_op(): yes if cod_y is a %memo lookup.
+ */
+static inline c3_o
+_n_memo_op(c3_y cod_y)
+{
+  switch ( cod_y ) {
+    case SKIB: case SKIS: case SLIB: case SLIS:
+      return c3y;
+
+    default:
+      return c3n;
+  }
+}
+
+/* _n_thread(): build pog_u's direct-threaded form, for dispatch through
+ *              tab (as offsets from bas_y).  produce the slots.
+ *
+ *   each instruction gets a slot: its handler's offset, tagged with
+ *   its opcode (for profiling), and its operand, decoded.  skips are
+ *   retargeted from bytes to slots, and a %memo op gets a second slot
+ *   holding the skip taken on a hit.  offsets, rather than addresses,
+ *   keep the slots valid when programs are copied or packed.
+ */
+static u3n_slot*
+_n_thread(u3n_prog* pog_u, void** tab, c3_y* bas_y)
+{
+  c3_y*     pog   = pog_u->byc_u.ops_y;
+  c3_w      len_w = pog_u->byc_u.len_w;
+  u3n_slot* sot_u = pog_u->thr_u.ops_u;
+  c3_w*     inx_w = c3_malloc(sizeof(c3_w) * (len_w + 1));
+  c3_w      ip_w, i_w;
+  c3_y      cod_y;
+  c3_w      arg_w;
+
+  //  slot index of each instruction
+  //
+  for ( ip_w = 0, i_w = 0; ip_w < len_w; ) {
+    cod_y       = pog[ip_w];
+    inx_w[ip_w] = i_w;
+    ip_w       += 1 + _n_arg(cod_y);
+    i_w        += ( c3y == _n_memo_op(cod_y) ) ? 2 : 1;
+  }
+  inx_w[len_w] = i_w;
+  c3_assert( i_w == pog_u->thr_u.len_w );
+
+  for ( ip_w = 0, i_w = 0; ip_w < len_w; i_w++ ) {
+    cod_y = pog[ip_w++];
+
+    switch ( _n_arg(cod_y) ) {
+      default:             arg_w = 0;                     break;
+      case sizeof(c3_y):   arg_w = pog[ip_w++];           break;
+      case sizeof(c3_s):   arg_w = _n_resh(pog, &ip_w);   break;
+      case sizeof(c3_l):   arg_w = _n_rewo(pog, &ip_w);   break;
+    }
+
+    switch ( cod_y ) {
+      default: break;
+
+      //  skips count from the next slot
+      //
+      case SBIP: case SBIN: case ZBIN: case DBIN:
+      case SIPS: case SINS: case ZINS: case DINS:
+      case SWIP: case SWIN: case ZWIN: case DWIN:
+        arg_w = inx_w[ip_w + arg_w] - (i_w + 1);
+        break;
+    }
+
+    sot_u[i_w].lab_w = ((c3_w)((c3_y*)tab[cod_y] - bas_y) << 8) | cod_y;
+    sot_u[i_w].arg_w = arg_w;
+
+    if ( c3y == _n_memo_op(cod_y) ) {
+      c3_l sip_l = pog_u->mem_u.sot_u[arg_w].sip_l;
+
+      i_w++;
+      sot_u[i_w].lab_w = ((c3_w)((c3_y*)tab[BAIL] - bas_y) << 8) | cod_y;
+      sot_u[i_w].arg_w = inx_w[ip_w + sip_l] - (i_w + 1);
+    }
+  }
+
+  c3_free(inx_w);
+  pog_u->thr_u.liv_o = c3y;
+  return sot_u;
+}
+
+/* Instruction stream access in _n_burn(), by representation.
+ *
+ *   NEXT():          dispatch the next instruction
+ *   CODE(i):         opcode of the instruction at i
+ *   OPB/OPS/OPW():   byte/short/word operand of the current instruction
+ *   MEMO_SKIP(mem):  skip taken on a %memo hit (consumes its slot)
+ *   ENTER(gop):      stream for entering program gop
+ *   RESUME(gop):     stream for returning into program gop
+ */
+#ifdef THREADED_BYTECODE
+#  define NEXT()          goto *(bas_y + ((c3_ws)pog[ip_w++].lab_w >> 8))
+#  define CODE(i)         ((c3_y)pog[i].lab_w)
+#  define OPB()           (pog[ip_w - 1].arg_w)
+#  define OPS()           (pog[ip_w - 1].arg_w)
+#  define OPW()           (pog[ip_w - 1].arg_w)
+#  define MEMO_SKIP(mem)  (pog[ip_w++].arg_w)
+#  define ENTER(gop)      ( ( c3y == (gop)->thr_u.liv_o )                     \
+                            ? (gop)->thr_u.ops_u                              \
+                            : _n_thread((gop), tab, bas_y) )
+#  define RESUME(gop)     ((gop)->thr_u.ops_u)
+#else
+#  define NEXT()          goto *tab[pog[ip_w++]]
+#  define CODE(i)         (pog[i])
+#  define OPB()           (pog[ip_w++])
+#  define OPS()           _n_resh(pog, &ip_w)
+#  define OPW()           _n_rewo(pog, &ip_w)
+#  define MEMO_SKIP(mem)  ((mem)->sip_l)
+#  define ENTER(gop)      ((gop)->byc_u.ops_y)
+#  define RESUME(gop)     ((gop)->byc_u.ops_y)
+#endif
 
 /* _n_burn(): pog: program
  *            bus: subject (TRANSFER)
@@ -1858,26 +3288,39 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
   static void* lab[] = { OPCODES };
 # undef X
 
+  // When profiling, every opcode dispatches through do_prof.
+  static void* pro[LAST] = { [0 ... LAST - 1] = &&do_prof };
+  void**       tab = ( u3C.wag_w & u3o_debug_cpu ) ? pro : lab;
+
   u3j_site* sit_u;
   u3j_rite* rit_u;
   u3n_memo* mem_u;
-  c3_y *pog = pog_u->byc_u.ops_y;
   c3_w sip_w, ip_w = 0;
   u3_noun* top;
   u3_noun x, o;
   u3p(void) empty;
   burnframe* fam;
+  _n_prof* out_u;
+  c3_y pre_y = HALT;
+#ifdef THREADED_BYTECODE
+  c3_y*     bas_y = &&do_halt;
+  u3n_slot* pog   = ENTER(pog_u);
+#else
+  c3_y*     pog   = ENTER(pog_u);
+#endif
 
   empty = u3R->cap_p;
+  _n_room(pog_u, off);
   _n_push(mov, off, bus);
+  out_u = _n_prof_in(pog_u);
 
 #ifdef U3_CPU_DEBUG
   u3R->pro.nox_d += 1;
 #endif
 #ifdef VERBOSE_BYTECODE
-  #define BURN() fprintf(stderr, "%s ", opcode_names[pog[ip_w]]); goto *lab[pog[ip_w++]]
+  #define BURN() fprintf(stderr, "%s ", opcode_names[CODE(ip_w)]); NEXT()
 #else
-  #define BURN() goto *lab[pog[ip_w++]]
+  #define BURN() NEXT()
 #endif
   BURN();
   {
@@ -1887,22 +3330,28 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       fprintf(stderr, "return\r\n");
 #endif
       if ( empty == u3R->cap_p ) {
+        _n_prof_out(out_u);
         return x;
       }
       else {
         fam   = u3to(burnframe, u3R->cap_p) + off;
         pog_u = fam->pog_u;
-        pog   = pog_u->byc_u.ops_y;
+        pog   = RESUME(pog_u);
         ip_w  = fam->ip_w;
 
         u3R->cap_p = u3of(burnframe, fam - (mov+off));
         _n_push(mov, off, x);
+        _n_prof_back(pog_u);
 #ifdef VERBOSE_BYTECODE
         _n_print_byc(pog, ip_w);
 #endif
         BURN();
       }
 
+    do_prof:
+      _n_prof_op(&pre_y, CODE(ip_w - 1));
+      goto *lab[CODE(ip_w - 1)];
+
     do_bail:
       u3m_bail(c3__exit);
       return u3_none;
@@ -1970,38 +3419,38 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       BURN();
 
     do_fisk:
-      x = pog_u->lit_u.non[_n_resh(pog, &ip_w)];
+      x = pog_u->lit_u.non[OPS()];
       goto frag_in;
 
     do_fibk:
-      x = pog_u->lit_u.non[pog[ip_w++]];
+      x = pog_u->lit_u.non[OPB()];
       goto frag_in;
 
     do_fask:
-      x = _n_resh(pog, &ip_w);
+      x = OPS();
       goto frag_in;
 
     do_fabk:
-      x = pog[ip_w++];
+      x = OPB();
     frag_in:
       top = _n_peek(off);
       _n_push(mov, off, u3k(u3x_at(x, *top)));
       BURN();
 
     do_fisl:
-      x = pog_u->lit_u.non[_n_resh(pog, &ip_w)];
+      x = pog_u->lit_u.non[OPS()];
       goto flag_in;
 
     do_fibl:
-      x = pog_u->lit_u.non[pog[ip_w++]];
+      x = pog_u->lit_u.non[OPB()];
       goto flag_in;
 
     do_fasl:
-      x = _n_resh(pog, &ip_w);
+      x = OPS();
       goto flag_in;
 
     do_fabl:
-      x = pog[ip_w++];
+      x = OPB();
     flag_in:
       top  = _n_peek(off);
       o    = *top;
@@ -2018,19 +3467,19 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       BURN();
 
     do_litb:
-      _n_push(mov, off,  pog[ip_w++]);
+      _n_push(mov, off,  OPB());
       BURN();
 
     do_lits:
-      _n_push(mov, off, _n_resh(pog, &ip_w));
+      _n_push(mov, off, OPS());
       BURN();
 
     do_libk:
-      _n_push(mov, off, u3k(pog_u->lit_u.non[pog[ip_w++]]));
+      _n_push(mov, off, u3k(pog_u->lit_u.non[OPB()]));
       BURN();
 
     do_lisk:
-      _n_push(mov, off, u3k(pog_u->lit_u.non[_n_resh(pog, &ip_w)]));
+      _n_push(mov, off, u3k(pog_u->lit_u.non[OPS()]));
       BURN();
 
     do_lil1:
@@ -2038,19 +3487,19 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       goto lil_in;
 
     do_lilb:
-      x = pog[ip_w++];
+      x = OPB();
       goto lil_in;
 
     do_lils:
-      x = _n_resh(pog, &ip_w);
+      x = OPS();
       goto lil_in;
 
     do_libl:
-      x = u3k(pog_u->lit_u.non[pog[ip_w++]]);
+      x = u3k(pog_u->lit_u.non[OPB()]);
       goto lil_in;
 
     do_lisl:
-      x = u3k(pog_u->lit_u.non[_n_resh(pog, &ip_w)]);
+      x = u3k(pog_u->lit_u.non[OPS()]);
       goto lil_in;
 
     do_lil0:
@@ -2083,8 +3532,10 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       _n_push(mov, off, x);
     nock_out:
       pog_u = _n_find(u3_nul, o);
-      pog   = pog_u->byc_u.ops_y;
+      pog   = ENTER(pog_u);
       ip_w  = 0;
+      _n_room(pog_u, off);
+      _n_prof_in(pog_u);
 #ifdef U3_CPU_DEBUG
     u3R->pro.nox_d += 1;
 #endif
@@ -2131,7 +3582,7 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
 
     do_samb:
       top = _n_peek(off);
-      if ( *top == pog[ip_w++] ) {
+      if ( *top == OPB() ) {
         *top = c3y;
       }
       else {
@@ -2142,7 +3593,7 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
 
     do_sams:
       top = _n_peek(off);
-      if ( *top == _n_resh(pog, &ip_w) ) {
+      if ( *top == OPS() ) {
         *top = c3y;
       }
       else {
@@ -2152,10 +3603,10 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       BURN();
 
     do_sans:
-      x = pog_u->lit_u.non[_n_resh(pog, &ip_w)];
+      x = pog_u->lit_u.non[OPS()];
       goto samn_in;
     do_sanb:
-      x = pog_u->lit_u.non[pog[ip_w++]];
+      x = pog_u->lit_u.non[OPB()];
     samn_in:
       top  = _n_peek(off);
       o    = *top;
@@ -2189,30 +3640,30 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       BURN();
 
     do_sbip:
-      sip_w = pog[ip_w++];
+      sip_w = OPB();
       ip_w += sip_w;
       BURN();
 
     do_sips:
-      sip_w = _n_resh(pog, &ip_w);
+      sip_w = OPS();
       ip_w += sip_w;
       BURN();
 
     do_swip:
-      sip_w = _n_rewo(pog, &ip_w);
+      sip_w = OPW();
       ip_w += sip_w;
       BURN();
 
     do_swin:
-      sip_w = _n_rewo(pog, &ip_w);
+      sip_w = OPW();
       goto skin_in;
 
     do_sins:
-      sip_w = _n_resh(pog, &ip_w);
+      sip_w = OPS();
       goto skin_in;
 
     do_sbin:
-      sip_w = pog[ip_w++];
+      sip_w = OPB();
     skin_in:
       x     = _n_pep(mov, off);
       if ( c3n == x ) {
@@ -2225,11 +3676,11 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       BURN();
 
     do_kics:
-      x = _n_resh(pog, &ip_w);
+      x = OPS();
       goto kick_in;
 
     do_kicb:
-      x = pog[ip_w++];
+      x = OPB();
     kick_in:
       sit_u = &(pog_u->cal_u.sit_u[x]);
       top   = _n_peek(off);
@@ -2244,8 +3695,10 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
         fam->pog_u  = pog_u;
 
         pog_u = u3to(u3n_prog, sit_u->pog_p);
-        pog   = pog_u->byc_u.ops_y;
+        pog   = ENTER(pog_u);
         ip_w  = 0;
+        _n_room(pog_u, off);
+        _n_prof_in(pog_u);
 #ifdef U3_CPU_DEBUG
     u3R->pro.nox_d += 1;
 #endif
@@ -2263,11 +3716,11 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       BURN();
 
     do_tics:
-      x = _n_resh(pog, &ip_w);
+      x = OPS();
       goto tick_in;
 
     do_ticb:
-      x = pog[ip_w++];
+      x = OPB();
     tick_in:
       sit_u = &(pog_u->cal_u.sit_u[x]);
       top   = _n_peek(off);
@@ -2276,8 +3729,10 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       if ( u3_none == *top ) {
         *top  = o;
         pog_u = u3to(u3n_prog, sit_u->pog_p);
-        pog   = pog_u->byc_u.ops_y;
+        pog   = ENTER(pog_u);
         ip_w  = 0;
+        _n_room(pog_u, off);
+        _n_prof_in(pog_u);
 #ifdef U3_CPU_DEBUG
     u3R->pro.nox_d += 1;
 #endif
@@ -2325,17 +3780,27 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       }
 
     do_sush:
-      x = _n_resh(pog, &ip_w);
+      x = OPS();
       goto cush_in;
 
     do_bush:
-      x = pog[ip_w++];
+      x = OPB();
     cush_in:
       x = u3k(pog_u->lit_u.non[x]);
       o = _n_pep(mov, off);
       u3t_push(u3nc(x, o));
       BURN();
 
+    do_taxs:
+      x = OPS();
+      goto taxb_in;
+
+    do_taxb:
+      x = OPB();
+    taxb_in:
+      u3t_lend(pog_u->lit_u.non[x]);
+      BURN();
+
     do_drop:
       u3t_drop();
       BURN();
@@ -2366,18 +3831,18 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
 
 
     do_sast:
-      x   = _n_resh(pog, &ip_w);
+      x   = OPS();
       goto fast_in;
 
     do_bast:
-      x   = pog[ip_w++];
+      x   = OPB();
       goto fast_in;
 
     do_salt:
-      x   = _n_resh(pog, &ip_w);
+      x   = OPS();
       goto falt_in;
     do_balt:
-      x   = pog[ip_w++];
+      x   = OPB();
     falt_in:                   // [pro bus clu]
       o   = _n_pep(mov, off);  // [bus clu]
       _n_toss(mov, off);       // [clu]
@@ -2396,11 +3861,11 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       BURN();
 
     do_skis:
-      x     = _n_resh(pog, &ip_w);
+      x     = OPS();
       goto skim_in;
 
     do_skib:
-      x     = pog[ip_w++];
+      x     = OPB();
     skim_in:
       mem_u = &(pog_u->mem_u.sot_u[x]);
       top   = _n_peek(off);
@@ -2408,24 +3873,41 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       goto skim_out;
 
     do_slis:
-      x     = _n_resh(pog, &ip_w);
+      x     = OPS();
       goto slim_in;
 
     do_slib:
-      x     = pog[ip_w++];
+      x     = OPB();
     slim_in:
       mem_u = &(pog_u->mem_u.sot_u[x]);
       x     = _n_pep(mov, off);
     skim_out:
+      sip_w = MEMO_SKIP(mem_u);
       o     = u3k(mem_u->key);
       x     = u3nc(x, o);
       o     = u3z_find_m(144 + c3__nock, x);
+      if ( u3_none != o ) {
+        _n_memo_d[0]++;
+      }
+      else if ( c3y == _n_memo_on() ) {
+        o = _n_memo_find(x);
+      }
+
       if ( u3_none == o ) {
-        _n_push(mov, off, x);
-        _n_push(mov, off, u3k(u3h(x)));
+        _n_memo_d[2]++;
+        //  kept results are costed, so SAVE gets [key tim]
+        //
+        if ( c3y == _n_memo_on() ) {
+          _n_push(mov, off, u3nc(x, _n_memo_time()));
+          _n_push(mov, off, u3k(u3h(x)));
+        }
+        else {
+          _n_push(mov, off, x);
+          _n_push(mov, off, u3k(u3h(x)));
+        }
       }
       else {
-        ip_w += mem_u->sip_l;
+        ip_w += sip_w;
         _n_push(mov, off, o);
         u3z(x);
       }
@@ -2435,19 +3917,22 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       x   = _n_pep(mov, off);
       top = _n_peek(off);
       o   = *top;
+      if ( c3y == _n_memo_on() ) {
+        _n_memo_save(u3h(o), u3t(o), x);
+      }
       if ( &(u3H->rod_u) != u3R ) {
-        u3z_save_m(144 + c3__nock, o, x);
+        u3z_save_m(144 + c3__nock, ( c3y == _n_memo_on() ) ? u3h(o) : o, x);
       }
       *top = x;
       u3z(o);
       BURN();
 
     do_hilb:
-      x = pog[ip_w++];
+      x = OPB();
       goto hilt_fore_in;
 
     do_hils:
-      x = _n_resh(pog, &ip_w);
+      x = OPS();
     hilt_fore_in:
       x   = u3k(pog_u->lit_u.non[x]);
       top = _n_peek(off);   // bus
@@ -2458,11 +3943,11 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       BURN();
 
     do_hinb:
-      x = pog[ip_w++];
+      x = OPB();
       goto hint_fore_in;
 
     do_hins:
-      x = _n_resh(pog, &ip_w);
+      x = OPS();
     hint_fore_in:               //  [clu bus]
       x   = u3k(pog_u->lit_u.non[x]);
       o   = _n_pep(mov, off);   //  [bus]
@@ -2546,38 +4031,38 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
       BURN();
 
     do_kitb:
-      x = pog_u->lit_u.non[pog[ip_w++]];
+      x = pog_u->lit_u.non[OPB()];
       goto kut_in;
 
     do_kits:
-      x = pog_u->lit_u.non[_n_resh(pog, &ip_w)];
+      x = pog_u->lit_u.non[OPS()];
       goto kut_in;
 
     do_kuts:
-      x = _n_resh(pog, &ip_w);
+      x = OPS();
       goto kut_in;
 
     do_kutb:
-      x = pog[ip_w++];
+      x = OPB();
     kut_in:
       o   = _n_pep(mov, off);
       top = _n_swap(mov, off);
       goto edit_in;
 
     do_mitb:
-      x = pog_u->lit_u.non[pog[ip_w++]];
+      x = pog_u->lit_u.non[OPB()];
       goto mut_in;
 
     do_mits:
-      x = pog_u->lit_u.non[_n_resh(pog, &ip_w)];
+      x = pog_u->lit_u.non[OPS()];
       goto mut_in;
 
     do_muts:
-      x = _n_resh(pog, &ip_w);
+      x = OPS();
       goto mut_in;
 
     do_mutb:
-      x = pog[ip_w++];
+      x = OPB();
     mut_in:
       o = _n_pep(mov, off);
       _n_toss(mov, off);
@@ -2585,6 +4070,115 @@ _n_burn(u3n_prog* pog_u, u3_noun bus, c3_ys mov, c3_ys off)
     edit_in:
       *top = u3i_edit(*top, x, o);
       BURN();
+
+    do_zwin:
+      sip_w = OPW();
+      goto zkin_in;
+
+    do_zins:
+      sip_w = OPS();
+      goto zkin_in;
+
+    do_zbin:
+      sip_w = OPB();
+    zkin_in:
+      x = _n_pep(mov, off);
+      if ( 0 != x ) {
+        u3z(x);
+        ip_w += sip_w;
+      }
+      BURN();
+
+    do_dwin:
+      sip_w = OPW();
+      goto dkin_in;
+
+    do_dins:
+      sip_w = OPS();
+      goto dkin_in;
+
+    do_dbin:
+      sip_w = OPB();
+    dkin_in:
+      x = _n_pep(mov, off);
+      o = u3du(x);
+      u3z(x);
+      if ( c3n == o ) {
+        ip_w += sip_w;
+      }
+      BURN();
+
+    do_kops:
+      x = OPS();
+      goto kop_in;
+
+    do_kopb:
+      x = OPB();
+    kop_in:
+      top = _n_peek(off);
+      _n_push(mov, off, u3k(*top));
+      goto kick_in;
+
+    do_pins:
+      x = pog_u->lit_u.non[OPS()];
+      goto pin_in;
+
+    do_pinb:
+      x = pog_u->lit_u.non[OPB()];
+    pin_in:
+      top = _n_peek(off);
+      _n_push(mov, off, u3nc(u3k(x), u3k(*top)));
+      BURN();
+
+    do_pils:
+      x = pog_u->lit_u.non[OPS()];
+      goto pil_in;
+
+    do_pilb:
+      x = pog_u->lit_u.non[OPB()];
+    pil_in:
+      top  = _n_peek(off);
+      *top = u3nc(u3k(x), *top);
+      BURN();
+
+    do_dirs:
+      x = OPS();
+      goto dire_in;
+
+    do_dirb:
+      x = OPB();
+    dire_in:
+      sit_u      = &(pog_u->cal_u.sit_u[x]);
+      o          = _n_pep(mov, off);
+      fam        = u3to(burnframe, u3R->cap_p) + off + mov;
+      u3R->cap_p = u3of(burnframe, fam - off);
+      fam->ip_w  = ip_w;
+      fam->pog_u = pog_u;
+      _n_push(mov, off, o);
+      goto dite_out;
+
+    do_dits:
+      x = OPS();
+      goto dite_in;
+
+    do_ditb:
+      x = OPB();
+    dite_in:
+      sit_u = &(pog_u->cal_u.sit_u[x]);
+    dite_out:
+      pog_u = _n_dire(sit_u);
+      pog   = ENTER(pog_u);
+      ip_w  = 0;
+      _n_room(pog_u, off);
+      _n_prof_in(pog_u);
+#ifdef U3_CPU_DEBUG
+      u3R->pro.nox_d += 1;
+#endif
+#ifdef VERBOSE_BYTECODE
+      fprintf(stderr, "\r\ndirect jump\r\n");
+      _n_print_byc(pog, ip_w);
+#endif
+      BURN();
   }
 }
 
@@ -2711,17 +4305,26 @@ _cn_take_prog_cb(u3p(u3n_prog) pog_p)
 
   if ( c3y == pog_u->byc_u.own_o ) {
     gop_u = _n_prog_new(pog_u->byc_u.len_w,
+                        pog_u->thr_u.len_w,
                         pog_u->cal_u.len_w,
                         pog_u->reg_u.len_w,
                         pog_u->lit_u.len_w,
                         pog_u->mem_u.len_w);
     memcpy(gop_u->byc_u.ops_y, pog_u->byc_u.ops_y, pog_u->byc_u.len_w);
+    gop_u->byc_u.hig_w = pog_u->byc_u.hig_w;
+
+    //  slots are position-independent
+    //
+    memcpy(gop_u->thr_u.ops_u, pog_u->thr_u.ops_u,
+           sizeof(u3n_slot) * pog_u->thr_u.len_w);
+    gop_u->thr_u.liv_o = pog_u->thr_u.liv_o;
   }
   else {
     gop_u = _n_prog_old(pog_u);
   }
 
   _cn_take_prog_dat(gop_u, pog_u);
+  gop_u->mug_l = pog_u->mug_l;
   // _n_prog_take_dat(gop_u, pog_u, c3n);
 
   return u3of(u3n_prog, gop_u);
@@ -2784,7 +4387,14 @@ _cn_merge_prog_cb(u3_noun kev, void* wit)
   if ( u3_none != got ) {
     u3n_prog* sep_u = u3to(u3n_prog, got);
     _cn_merge_prog_dat(sep_u, pog_u);
-    u3a_free(pog_u);
+    //  a junior copy may have threaded the slots it shares with sep_u
+    //
+    if (  (c3y == pog_u->thr_u.liv_o)
+       && (pog_u->thr_u.ops_u == sep_u->thr_u.ops_u) )
+    {
+      sep_u->thr_u.liv_o = c3y;
+    }
+    u3a_free(pog_u);
     pog_u = sep_u;
   }
 
@@ -2801,6 +4411,46 @@ u3n_reap(u3p(u3h_root) har_p)
   u3h_free(har_p);
 }
 
+/* u3n_memo_take(): copy junior kept %memo results.
+*/
+u3p(u3h_root)
+u3n_memo_take(u3p(u3h_root) har_p)
+{
+  return ( har_p ) ? u3h_take(har_p) : 0;
+}
+
+/* _n_memo_reap_cb(): u3h_walk_with helper for u3n_memo_reap().
+*/
+static void
+_n_memo_reap_cb(u3_noun kev, void* wit)
+{
+  u3p(u3h_root)* har_p = wit;
+  u3_noun        key, cos, sco, pro;
+  u3_weak        got;
+
+  u3x_qual(kev, &key, &cos, &sco, &pro);
+
+  if ( *har_p && (u3_none != (got = u3h_git(*har_p, key))) ) {
+    sco = c3_min(0x7fffffff, sco + u3h(u3t(got)));
+  }
+  else {
+    _n_memo_d[6]++;
+  }
+
+  _n_memo_put(har_p, key, u3nt(cos, sco, u3k(pro)));
+}
+
+/* u3n_memo_reap(): promote kept %memo results, summing scores.
+*/
+void
+u3n_memo_reap(u3p(u3h_root) har_p)
+{
+  if ( har_p ) {
+    u3h_walk_with(har_p, _n_memo_reap_cb, &(u3R->mem.har_p));
+    u3h_free(har_p);
+  }
+}
+
 /* _n_ream(): ream program call sites
 */
 void
@@ -2810,7 +4460,13 @@ _n_ream(u3_noun kev)
   u3n_prog* pog_u = u3to(u3n_prog, u3t(kev));
 
   // fix up pointers for loom portability
-  pog_u->byc_u.ops_y = (c3_y*) _n_prog_dat(pog_u);
+  //
+  //   the threaded form holds handler offsets, which may
+  //   have changed with the binary; rebuild it on entry
+  //
+  pog_u->thr_u.liv_o = c3n;
+  pog_u->thr_u.ops_u = (u3n_slot*) _n_prog_dat(pog_u);
+  pog_u->byc_u.ops_y = (c3_y*) (pog_u->thr_u.ops_u + pog_u->thr_u.len_w);
   pog_u->lit_u.non   = (u3_noun*) (pog_u->byc_u.ops_y + pog_u->byc_u.len_w);
   pog_u->mem_u.sot_u = (u3n_memo*) (pog_u->lit_u.non + pog_u->lit_u.len_w);
   pog_u->cal_u.sit_u = (u3j_site*) (pog_u->mem_u.sot_u + pog_u->mem_u.len_w);
@@ -2877,9 +4533,540 @@ u3n_mark(FILE* fil_u)
 
   bam_w = u3a_maid(fil_u, "  bytecode programs", bam_w);
   har_w = u3a_maid(fil_u, "  bytecode cache", u3h_mark(har_p));
+
+  if ( u3R->mem.har_p ) {
+    har_w += u3a_maid(fil_u, "  kept memo results",
+                             u3h_mark(u3R->mem.har_p));
+  }
+
   return  u3a_maid(fil_u, "total nock stuff", bam_w + har_w);
 }
 
+/* _n_pair: census entry for sorting.
+ */
+typedef struct {
+  c3_d num_d;
+  c3_y one_y;
+  c3_y two_y;
+} _n_pair;
+
+/* _n_pair_cmp(): qsort comparator, descending by count.
+ */
+static int
+_n_pair_cmp(const void* a_v, const void* b_v)
+{
+  const _n_pair* a_u = a_v;
+  const _n_pair* b_u = b_v;
+
+  return ( a_u->num_d < b_u->num_d ) ?  1
+       : ( a_u->num_d > b_u->num_d ) ? -1
+       : 0;
+}
+
+/* _n_sick: kick sites that have missed, for sorting.
+ */
+typedef struct {
+  c3_w       len_w;
+  c3_w       all_w;
+  u3j_site** sit_u;
+} _n_sick;
+
+/* _n_sick_walk(): u3h_walk_with helper for u3n_damp.
+ */
+static void
+_n_sick_walk(u3_noun kev, void* dat)
+{
+  _n_sick*  sic_u = dat;
+  u3n_prog* pog_u = u3to(u3n_prog, u3t(kev));
+  c3_w      i_w;
+
+  for ( i_w = 0; i_w < pog_u->cal_u.len_w; i_w++ ) {
+    u3j_site* sit_u = &(pog_u->cal_u.sit_u[i_w]);
+
+    if ( 0 != sit_u->mis_w ) {
+      if ( sic_u->len_w == sic_u->all_w ) {
+        sic_u->all_w = c3_max(64, 2 * sic_u->all_w);
+        sic_u->sit_u = c3_realloc(sic_u->sit_u,
+                                  sic_u->all_w * sizeof(u3j_site*));
+      }
+      sic_u->sit_u[sic_u->len_w++] = sit_u;
+    }
+  }
+}
+
+/* _n_sick_cmp(): qsort comparator, descending by misses.
+ */
+static int
+_n_sick_cmp(const void* a_v, const void* b_v)
+{
+  const u3j_site* a_u = *(u3j_site* const*)a_v;
+  const u3j_site* b_u = *(u3j_site* const*)b_v;
+
+  return ( a_u->mis_w < b_u->mis_w ) ?  1
+       : ( a_u->mis_w > b_u->mis_w ) ? -1
+       : 0;
+}
+
+/* _n_sick_damp(): print and clear kick site hit/miss counters.
+ */
+static void
+_n_sick_damp(FILE* fil_u)
+{
+  _n_sick sic_u = { 0, 0, NULL };
+  c3_d    hit_d = 0, mis_d = 0;
+  c3_w    i_w, j_w;
+
+  u3h_walk_with(u3R->byc.har_p, _n_sick_walk, &sic_u);
+
+  if ( 0 == sic_u.len_w ) {
+    return;
+  }
+
+  qsort(sic_u.sit_u, sic_u.len_w, sizeof(u3j_site*), _n_sick_cmp);
+
+  for ( i_w = 0; i_w < sic_u.len_w; i_w++ ) {
+    hit_d += sic_u.sit_u[i_w]->hit_w;
+    mis_d += sic_u.sit_u[i_w]->mis_w;
+  }
+
+  fprintf(fil_u, "kick sites: %u missing, "
+                 "%" PRIu64 " hits, %" PRIu64 " misses\r\n",
+                 sic_u.len_w, hit_d, mis_d);
+
+  for ( i_w = 0; (i_w < sic_u.len_w) && (i_w < 32); i_w++ ) {
+    u3j_site* sit_u = sic_u.sit_u[i_w];
+    u3j_line* lin_u = &(sit_u->lin_u[0]);
+
+    for ( j_w = 0; j_w < u3j_site_ways; j_w++ ) {
+      if ( u3_none == sit_u->lin_u[j_w].bat ) {
+        break;
+      }
+    }
+
+    fprintf(fil_u, "  %u hits, %u misses, %u ways: ",
+                   sit_u->hit_w, sit_u->mis_w, j_w);
+
+    if ( u3_none == lin_u->lab ) {
+      fprintf(fil_u, "(unlocated)\r\n");
+    }
+    else {
+      c3_c* lab_c = u3m_pretty_path(lin_u->lab);
+      fprintf(fil_u, "%s\r\n", lab_c);
+      c3_free(lab_c);
+    }
+  }
+
+  for ( i_w = 0; i_w < sic_u.len_w; i_w++ ) {
+    sic_u.sit_u[i_w]->hit_w = 0;
+    sic_u.sit_u[i_w]->mis_w = 0;
+  }
+
+  c3_free(sic_u.sit_u);
+}
+
+/* _n_elide_damp(): print and clear refcount elision counters.
+ */
+static void
+_n_elide_damp(FILE* fil_u)
+{
+  c3_d tot_d = _n_elide_d[0] + _n_elide_d[1] + _n_elide_d[2];
+
+  if ( 0 == tot_d ) {
+    return;
+  }
+
+  fprintf(fil_u, "refcount elision: %" PRIu64 " pairs compiled away "
+                 "(%" PRIu64 " copy/toss, %" PRIu64 " literal/toss, "
+                 "%" PRIu64 " copy/lose), "
+                 "each saving a gain and a lose per run\r\n",
+                 tot_d, _n_elide_d[0], _n_elide_d[1], _n_elide_d[2]);
+
+  memset(_n_elide_d, 0, sizeof(_n_elide_d));
+}
+
+/* _n_memo_damp(): print and clear kept %memo counters.
+ */
+static void
+_n_memo_damp(FILE* fil_u)
+{
+  c3_d hit_d = _n_memo_d[0] + _n_memo_d[1];
+  c3_d tot_d = hit_d + _n_memo_d[2];
+
+  if ( 0 == tot_d ) {
+    return;
+  }
+
+  fprintf(fil_u, "memo: %" PRIu64 " lookups, %.2f%% hit "
+                 "(%" PRIu64 " road, %" PRIu64 " kept)\r\n",
+                 tot_d, (100.0 * hit_d) / tot_d, _n_memo_d[0], _n_memo_d[1]);
+
+  if ( u3C.wag_w & u3o_memo_keep ) {
+    fprintf(fil_u, "memo: %" PRIu64 " kept, %" PRIu64 " too cheap, "
+                   "%" PRIu64 " evicted, %" PRIu64 " promoted, "
+                   "%u on this road\r\n",
+                   _n_memo_d[3], _n_memo_d[4], _n_memo_d[5], _n_memo_d[6],
+                   ( u3R->mem.har_p )
+                   ? u3to(u3h_root, u3R->mem.har_p)->use_w : 0);
+  }
+
+  memset(_n_memo_d, 0, sizeof(_n_memo_d));
+}
+
+/* _n_prof_rank: the hottest profiled formulas, with arm labels.
+ *
+ *   a formula is labelled by the jet dashboard path and arm axis
+ *   of a registered (%fast) core that kicks it. labelled formulas
+ *   kicked without a jet driver are candidates for jetting.
+ */
+typedef struct {
+  c3_w     len_w;                       //  records
+  _n_prof* pro_u;                       //  records, by burn time
+  u3_weak* lab;                         //  [label axis] per record
+  c3_t*    unj_t;                       //  kicked without a driver
+} _n_prof_rank;
+
+/* _n_prof_cmp(): qsort comparator, descending by burn time.
+ */
+static int
+_n_prof_cmp(const void* a_v, const void* b_v)
+{
+  const _n_prof* a_u = a_v;
+  const _n_prof* b_u = b_v;
+
+  return ( a_u->tim_d < b_u->tim_d ) ?  1
+       : ( a_u->tim_d > b_u->tim_d ) ? -1
+       : 0;
+}
+
+/* _n_prof_walk(): u3h_walk_with helper for _n_prof_rank_make(),
+ *                 labelling ranked formulas from the kick sites that call them.
+ */
+static void
+_n_prof_walk(u3_noun kev, void* dat)
+{
+  _n_prof_rank* ran_u = dat;
+  u3n_prog*     pog_u = u3to(u3n_prog, u3t(kev));
+  c3_w          i_w, j_w, k_w;
+  _n_prof*      pro_u;
+
+  for ( i_w = 0; i_w < pog_u->cal_u.len_w; i_w++ ) {
+    u3j_site* sit_u = &(pog_u->cal_u.sit_u[i_w]);
+
+    for ( j_w = 0; j_w < u3j_site_ways; j_w++ ) {
+      u3j_line* lin_u = &(sit_u->lin_u[j_w]);
+      c3_l      mug_l;
+
+      if ( u3_none == lin_u->bat ) {
+        break;
+      }
+      else if ( (u3_none == lin_u->lab) || (0 == lin_u->pog_p) ) {
+        continue;
+      }
+
+      mug_l = u3to(u3n_prog, lin_u->pog_p)->mug_l;
+
+      if ( !(pro_u = _n_prof_look(mug_l)) ) {
+        continue;
+      }
+
+      k_w = pro_u->ran_w;
+
+      if ( u3_none == ran_u->lab[k_w] ) {
+        ran_u->lab[k_w] = u3nc(u3k(lin_u->lab), u3k(sit_u->axe));
+      }
+
+      if (  (c3n == lin_u->jet_o)
+         || (0 == lin_u->ham_u->fun_f)
+         || (c3n == lin_u->ham_u->liv) )
+      {
+        ran_u->unj_t[k_w] = 1;
+      }
+    }
+  }
+}
+
+/* _n_prof_rank_make(): rank all profiled formulas, and reset.
+ */
+static void
+_n_prof_rank_make(_n_prof_rank* ran_u)
+{
+  c3_w i_w, len_w = 0;
+
+  ran_u->pro_u = c3_malloc(sizeof(_n_prof) * ((1 << PROF_BITS) + 1));
+
+  if ( _n_prof_u ) {
+    for ( i_w = 0; i_w < (1 << PROF_BITS); i_w++ ) {
+      if ( 0 != _n_prof_u[i_w].mug_l ) {
+        ran_u->pro_u[len_w++] = _n_prof_u[i_w];
+      }
+    }
+  }
+
+  if ( 0 != _n_prof_oth_u.ent_w ) {
+    ran_u->pro_u[len_w++] = _n_prof_oth_u;
+  }
+
+  qsort(ran_u->pro_u, len_w, sizeof(_n_prof), _n_prof_cmp);
+
+  ran_u->len_w = len_w;
+  ran_u->lab   = c3_malloc(sizeof(u3_weak) * (len_w + 1));
+  ran_u->unj_t = c3_calloc(sizeof(c3_t) * (len_w + 1));
+
+  //  index the table by rank, for labelling
+  //
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    _n_prof* pro_u = _n_prof_look(ran_u->pro_u[i_w].mug_l);
+
+    if ( pro_u ) {
+      pro_u->ran_w = i_w;
+    }
+    ran_u->lab[i_w] = u3_none;
+  }
+
+  {
+    u3a_road* rod_u = u3R;
+
+    while ( 1 ) {
+      u3h_walk_with(rod_u->byc.har_p, _n_prof_walk, ran_u);
+
+      if ( !rod_u->par_p ) {
+        break;
+      }
+      rod_u = u3to(u3a_road, rod_u->par_p);
+    }
+  }
+
+  if ( _n_prof_u ) {
+    memset(_n_prof_u, 0, sizeof(_n_prof) << PROF_BITS);
+  }
+
+  memset(&_n_prof_oth_u, 0, sizeof(_n_prof_oth_u));
+  _n_prof_cur_u = 0;
+}
+
+/* _n_prof_rank_free(): dispose of a ranking.
+ */
+static void
+_n_prof_rank_free(_n_prof_rank* ran_u)
+{
+  c3_w i_w;
+
+  for ( i_w = 0; i_w < ran_u->len_w; i_w++ ) {
+    u3z(ran_u->lab[i_w]);
+  }
+
+  c3_free(ran_u->unj_t);
+  c3_free(ran_u->lab);
+  c3_free(ran_u->pro_u);
+}
+
+/* _n_prof_ops_rank(): opcodes by descending dispatch count, and reset.
+ */
+static c3_w
+_n_prof_ops_rank(c3_y* cod_y, c3_d* num_d)
+{
+  c3_w i_w, j_w, len_w = 0;
+
+  for ( i_w = 0; i_w < LAST; i_w++ ) {
+    if ( 0 != _n_prof_ops_d[i_w] ) {
+      for ( j_w = len_w++; (j_w > 0) && (num_d[j_w - 1] < _n_prof_ops_d[i_w]); j_w-- ) {
+        cod_y[j_w] = cod_y[j_w - 1];
+        num_d[j_w] = num_d[j_w - 1];
+      }
+      cod_y[j_w] = i_w;
+      num_d[j_w] = _n_prof_ops_d[i_w];
+    }
+  }
+
+  memset(_n_prof_ops_d, 0, sizeof(_n_prof_ops_d));
+  return len_w;
+}
+
+/* u3n_prof(): bytecode profile since the last call, ranked, and reset.
+*/
+u3_noun
+u3n_prof(void)
+{
+  _n_prof_rank ran_u;
+  c3_y         cod_y[LAST];
+  c3_d         num_d[LAST];
+  c3_w         len_w = _n_prof_ops_rank(cod_y, num_d);
+  u3_noun      ops = u3_nul, pog = u3_nul, unj = u3_nul;
+
+  while ( len_w-- ) {
+    ops = u3nc(u3nc(u3i_string(opcode_names[cod_y[len_w]]),
+                    u3i_chub(num_d[len_w])),
+               ops);
+  }
+
+  _n_prof_rank_make(&ran_u);
+
+  for ( len_w = c3_min(ran_u.len_w, 32); len_w--; ) {
+    _n_prof* pro_u = &(ran_u.pro_u[len_w]);
+    u3_noun  lab   = ( u3_none == ran_u.lab[len_w] )
+                     ? u3_nul
+                     : u3nc(u3_nul, u3k(ran_u.lab[len_w]));
+
+    pog = u3nc(u3nq(pro_u->mug_l,
+                    lab,
+                    u3i_word(pro_u->ent_w),
+                    u3nc(u3i_chub(pro_u->ops_d), u3i_chub(pro_u->tim_d))),
+               pog);
+  }
+
+  {
+    c3_w i_w, num_w = 0;
+
+    for ( i_w = 0; (i_w < ran_u.len_w) && (num_w < 32); i_w++ ) {
+      if ( ran_u.unj_t[i_w] ) {
+        num_w++;
+      }
+    }
+
+    while ( num_w && i_w-- ) {
+      if ( ran_u.unj_t[i_w] ) {
+        _n_prof* pro_u = &(ran_u.pro_u[i_w]);
+
+        unj = u3nc(u3nt(u3k(ran_u.lab[i_w]),
+                        u3i_word(pro_u->ent_w),
+                        u3i_chub(pro_u->tim_d)),
+                   unj);
+        num_w--;
+      }
+    }
+  }
+
+  _n_prof_rank_free(&ran_u);
+  return u3nt(ops, pog, unj);
+}
+
+/* u3n_prof_unwind(): stop charging the program a bail unwound.
+ *
+ *   a bail longjmps past the _n_prof_out() of every burn it unwinds,
+ *   which would leave the crashed program charged for whatever runs
+ *   next.  the record keeps the time it has already spent.
+ */
+void
+u3n_prof_unwind(void)
+{
+  if ( _n_prof_cur_u ) {
+    _n_prof_swap(0);
+  }
+}
+
+/* _n_prof_damp(): print and clear the bytecode profile.
+ */
+static void
+_n_prof_damp(FILE* fil_u)
+{
+  _n_prof_rank ran_u;
+  c3_y         cod_y[LAST];
+  c3_d         num_d[LAST];
+  c3_w         len_w = _n_prof_ops_rank(cod_y, num_d);
+  c3_w         i_w, num_w;
+
+  _n_prof_rank_make(&ran_u);
+
+  if ( len_w ) {
+    fprintf(fil_u, "bytecode profile: opcodes\r\n");
+
+    for ( i_w = 0; i_w < len_w; i_w++ ) {
+      fprintf(fil_u, "  %s: %" PRIu64 "\r\n",
+                     opcode_names[cod_y[i_w]], num_d[i_w]);
+    }
+  }
+
+  if ( ran_u.len_w ) {
+    fprintf(fil_u, "bytecode profile: programs\r\n");
+  }
+
+  for ( i_w = 0; i_w < c3_min(ran_u.len_w, 64); i_w++ ) {
+    _n_prof* pro_u = &(ran_u.pro_u[i_w]);
+
+    fprintf(fil_u, "  %.3f ms, %u entries, %" PRIu64 " ops: ",
+                   pro_u->tim_d / 1e6, pro_u->ent_w, pro_u->ops_d);
+
+    if ( u3_none != ran_u.lab[i_w] ) {
+      c3_c* lab_c = u3m_pretty_path(u3h(ran_u.lab[i_w]));
+      fprintf(fil_u, "%s +%" PRIu64 "\r\n",
+                     lab_c, u3r_chub(0, u3t(ran_u.lab[i_w])));
+      c3_free(lab_c);
+    }
+    else if ( 0 == pro_u->mug_l ) {
+      fprintf(fil_u, "(others)\r\n");
+    }
+    else {
+      fprintf(fil_u, "formula 0x%x\r\n", pro_u->mug_l);
+    }
+  }
+
+  for ( i_w = 0, num_w = 0; (i_w < ran_u.len_w) && (num_w < 32); i_w++ ) {
+    if ( ran_u.unj_t[i_w] ) {
+      _n_prof* pro_u = &(ran_u.pro_u[i_w]);
+      c3_c*    lab_c = u3m_pretty_path(u3h(ran_u.lab[i_w]));
+
+      if ( !num_w++ ) {
+        fprintf(fil_u, "bytecode profile: unjetted arms\r\n");
+      }
+
+      fprintf(fil_u, "  %.3f ms, %u entries: %s +%" PRIu64 "\r\n",
+                     pro_u->tim_d / 1e6, pro_u->ent_w,
+                     lab_c, u3r_chub(0, u3t(ran_u.lab[i_w])));
+      c3_free(lab_c);
+    }
+  }
+
+  _n_prof_rank_free(&ran_u);
+}
+
+/* u3n_damp(): print and clear the bytecode pair census,
+ *             the kick site counters, refcount elisions,
+ *             %memo counters, and the bytecode profile.
+ */
+void
+u3n_damp(FILE* fil_u)
+{
+  _n_sick_damp(fil_u);
+  _n_elide_damp(fil_u);
+  _n_memo_damp(fil_u);
+  _n_prof_damp(fil_u);
+
+  _n_pair* par_u = c3_malloc(sizeof(*par_u) * LAST * LAST);
+  c3_w     len_w = 0, i_w, j_w;
+  c3_d     tot_d = 0;
+
+  c3_assert( 0 != fil_u );
+
+  for ( i_w = 0; i_w < LAST; i_w++ ) {
+    for ( j_w = 0; j_w < LAST; j_w++ ) {
+      if ( _n_pair_d[i_w][j_w] ) {
+        par_u[len_w].num_d = _n_pair_d[i_w][j_w];
+        par_u[len_w].one_y = i_w;
+        par_u[len_w].two_y = j_w;
+        tot_d += par_u[len_w].num_d;
+        len_w++;
+      }
+    }
+  }
+
+  qsort(par_u, len_w, sizeof(*par_u), _n_pair_cmp);
+
+  if ( tot_d ) {
+    fprintf(fil_u, "bytecode pairs: %" PRIu64 " dispatches\r\n", tot_d);
+
+    for ( i_w = 0; (i_w < len_w) && (i_w < 64); i_w++ ) {
+      fprintf(fil_u, "  %s %s: %" PRIu64 " (%.2f%%)\r\n",
+                     opcode_names[par_u[i_w].one_y],
+                     opcode_names[par_u[i_w].two_y],
+                     par_u[i_w].num_d,
+                     (100.0 * par_u[i_w].num_d) / tot_d);
+    }
+  }
+
+  c3_free(par_u);
+  memset(_n_pair_d, 0, sizeof(_n_pair_d));
+}
+
 /* u3n_reclaim(): clear ad-hoc persistent caches to reclaim memory.
 */
 void
@@ -2888,32 +5075,107 @@ u3n_reclaim(void)
   //  clear the bytecode cache
   //
   //    We can't just u3h_free() -- the value is a post to a u3n_prog.
-  //    Note that the hank cache *must* also be freed (in u3j_reclaim())
+  //    Note that the hank cache *must* also be freed (in u3j_reclaim()),
+  //    and that u3m_pack() keeps the bytecode cache but not the hanks.
   //
   u3n_free();
   u3R->byc.har_p = u3h_new();
+
+  //  drop kept %memo results
+  //
+  if ( u3R->mem.har_p ) {
+    u3h_free(u3R->mem.har_p);
+    u3R->mem.har_p = 0;
+  }
+}
+
+/* _n_prog_rewrite(): rewrite a program for compaction, producing its
+ *                    new location.
+ *
+ *   native pointers into the program's own data segment are shifted
+ *   by the distance it will move, after everything they point to has
+ *   been rewritten (u3a_pack_move() copies the words verbatim).
+ */
+static u3_post
+_n_prog_rewrite(u3n_prog* pog_u)
+{
+  u3_post pog_p = u3of(u3n_prog, pog_u);
+  u3_post gop_p = u3a_rewritten_mptr(pog_p);
+  c3_ws   dif_ws;
+  c3_w    i_w;
+
+  if ( c3n == u3a_rewrite_mptr(pog_u) ) {
+    return gop_p;
+  }
+
+  //  programs in the home road own their bytecode (see u3n_reap())
+  //
+  c3_assert( c3y == pog_u->byc_u.own_o );
+
+  for ( i_w = 0; i_w < pog_u->lit_u.len_w; ++i_w ) {
+    u3a_rewrite_noun(pog_u->lit_u.non[i_w]);
+    pog_u->lit_u.non[i_w] = u3a_rewritten_noun(pog_u->lit_u.non[i_w]);
+  }
+
+  for ( i_w = 0; i_w < pog_u->mem_u.len_w; ++i_w ) {
+    u3n_memo* mem_u = &(pog_u->mem_u.sot_u[i_w]);
+    u3a_rewrite_noun(mem_u->key);
+    mem_u->key = u3a_rewritten_noun(mem_u->key);
+  }
+
+  for ( i_w = 0; i_w < pog_u->cal_u.len_w; ++i_w ) {
+    u3j_site_rewrite(&(pog_u->cal_u.sit_u[i_w]));
+  }
+
+  for ( i_w = 0; i_w < pog_u->reg_u.len_w; ++i_w ) {
+    u3j_rite_rewrite(&(pog_u->reg_u.rit_u[i_w]));
+  }
+
+  dif_ws = (c3_ws)(gop_p - pog_p) * (c3_ws)sizeof(c3_w);
+
+  pog_u->thr_u.ops_u = (u3n_slot*)((c3_y*)pog_u->thr_u.ops_u + dif_ws);
+  pog_u->byc_u.ops_y = (c3_y*)pog_u->byc_u.ops_y + dif_ws;
+  pog_u->lit_u.non   = (u3_noun*)((c3_y*)pog_u->lit_u.non + dif_ws);
+  pog_u->mem_u.sot_u = (u3n_memo*)((c3_y*)pog_u->mem_u.sot_u + dif_ws);
+  pog_u->cal_u.sit_u = (u3j_site*)((c3_y*)pog_u->cal_u.sit_u + dif_ws);
+  pog_u->reg_u.rit_u = (u3j_rite*)((c3_y*)pog_u->reg_u.rit_u + dif_ws);
+
+  return gop_p;
 }
 
-/* u3n_rewrite_compact(): rewrite the bytecode cache for compaction.
+/* _n_rewrite(): u3h_walk helper for u3n_rewrite_compact.
  *
- * NB: u3R->byc.har_p *must* be cleared (currently via u3n_reclaim above),
- * since it contains things that look like nouns but aren't.
- * Specifically, it contains "cells" where the tail is a
- * pointer to a u3a_malloc'ed block that contains loom pointers.
+ *   the cache holds programs by pointer, in the tail of each entry;
+ *   rewrite the program, and point the entry at its new location.
+ */
+static void
+_n_rewrite(u3_noun kev)
+{
+  u3a_cell* kev_u = u3a_to_ptr(kev);
+
+  kev_u->tel = _n_prog_rewrite(u3to(u3n_prog, kev_u->tel));
+}
+
+/* u3n_rewrite_compact(): rewrite the bytecode cache (and kept
+ *                        %memo results) for compaction.
  *
- * You should be able to walk this with u3h_walk and rewrite the
- * pointers, but you need to be careful to handle that u3a_malloc
- * pointers can't be turned into a box by stepping back two words. You
- * must step back one word to get the padding, step then step back that
- * many more words (plus one?).
+ *   programs are rewritten before the hashtable, while the
+ *   entries that point to them can still be traversed.
  */
 void
 u3n_rewrite_compact()
 {
+  u3h_walk(u3R->byc.har_p, _n_rewrite);
   u3h_rewrite(u3R->byc.har_p);
   u3R->byc.har_p = u3a_rewritten(u3R->byc.har_p);
-}
 
+  //  kept %memo results also survive packing
+  //
+  if ( u3R->mem.har_p ) {
+    u3h_rewrite(u3R->mem.har_p);
+    u3R->mem.har_p = u3a_rewritten(u3R->mem.har_p);
+  }
+}
 
 /* _n_feb(): u3h_walk helper for u3n_free
  */
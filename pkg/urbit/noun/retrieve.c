@@ -1257,6 +1257,60 @@ u3r_mp(mpz_t   a_mp,
   }
 }
 
+/* u3r_mp_view():
+**
+**   Point (mpv_u) at (b), read-only, without copying if possible.
+*/
+void
+u3r_mp_view(u3r_mpv* mpv_u,
+            u3_atom  b)
+{
+  c3_assert(u3_none != b);
+  c3_assert(_(u3a_is_atom(b)));
+
+  mpv_u->buf = 0;
+
+  if ( _(u3a_is_cat(b)) ) {
+    mpv_u->sat = b;
+    mpz_roinit_n(mpv_u->mp, &mpv_u->sat, 1);
+  }
+  else {
+    u3a_atom* b_u   = u3a_to_ptr(b);
+    c3_w      len_w = b_u->len_w;
+    c3_w      wis_w = c3_wiseof(mp_limb_t);
+    c3_w      lim_w = (len_w + (wis_w - 1)) / wis_w;
+
+    //  atom words and limbs are both little-endian, so the words can
+    //  be read in place if they begin on a limb boundary and fill
+    //  their last limb; otherwise, copy them once into limbs
+    //
+    if (  (0 == ((c3_p)b_u->buf_w % sizeof(mp_limb_t)))
+       && (0 == (len_w % wis_w)) )
+    {
+      mpz_roinit_n(mpv_u->mp, (mp_limb_t*)b_u->buf_w, lim_w);
+    }
+    else {
+      mpv_u->buf = u3a_malloc(lim_w * sizeof(mp_limb_t));
+      mpv_u->buf[lim_w - 1] = 0;
+      memcpy(mpv_u->buf, b_u->buf_w, len_w * sizeof(c3_w));
+      mpz_roinit_n(mpv_u->mp, mpv_u->buf, lim_w);
+    }
+  }
+}
+
+/* u3r_mp_done():
+**
+**   Release the view (mpv_u).
+*/
+void
+u3r_mp_done(u3r_mpv* mpv_u)
+{
+  if ( mpv_u->buf ) {
+    u3a_free(mpv_u->buf);
+    mpv_u->buf = 0;
+  }
+}
+
 /* u3r_short():
 **
 **   Return short (a_w) of (b).
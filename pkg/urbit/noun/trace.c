@@ -10,12 +10,101 @@
 
 static c3_o _ct_lop_o;
 
+/* _ct_fram: lazy trace frame, materialized into bug.tax on demand.
+**
+**   frames live off-loom, in one stack shared by all roads, and
+**   are tagged with the road that pushed them.  a road's frames are
+**   always above its parent's, and above its own bug.tax entries.
+*/
+typedef struct _ct_fram {
+  u3_noun   mon;                        //  trace entry
+  c3_o      own_o;                      //  yes if mon is retained
+  u3a_road* rod_u;                      //  pushing road
+} _ct_fram;
+
+static struct {
+  c3_w      len_w;                      //  frames in use
+  c3_w      siz_w;                      //  frames allocated
+  _ct_fram* fam_u;                      //  frames
+} _ct_tax_u;
+
+/* _ct_fram_push(): push a lazy frame.
+*/
+static inline void
+_ct_fram_push(u3_noun mon, c3_o own_o)
+{
+  if ( _ct_tax_u.len_w == _ct_tax_u.siz_w ) {
+    _ct_tax_u.siz_w = _ct_tax_u.siz_w ? (2 * _ct_tax_u.siz_w) : 256;
+    _ct_tax_u.fam_u = c3_realloc(_ct_tax_u.fam_u,
+                                 _ct_tax_u.siz_w * sizeof(_ct_fram));
+  }
+
+  {
+    _ct_fram* fam_u = &(_ct_tax_u.fam_u[_ct_tax_u.len_w++]);
+
+    fam_u->mon   = mon;
+    fam_u->own_o = own_o;
+    fam_u->rod_u = u3R;
+  }
+}
+
+/* _ct_fram_base(): index of the bottom frame pushed by [rod_u].
+*/
+static c3_w
+_ct_fram_base(u3a_road* rod_u)
+{
+  c3_w len_w = _ct_tax_u.len_w;
+
+  while ( len_w && (rod_u == _ct_tax_u.fam_u[len_w - 1].rod_u) ) {
+    len_w--;
+  }
+  return len_w;
+}
+
+/* _ct_tax(): copy of [rod_u]'s trace, including pending frames.
+*/
+static u3_noun
+_ct_tax(u3a_road* rod_u)
+{
+  u3_noun tax = u3k(rod_u->bug.tax);
+  c3_w  las_w = _ct_tax_u.len_w;
+  c3_w  i_w;
+
+  //  [rod_u] may not be innermost; skip its juniors' frames
+  //
+  while ( las_w && (rod_u != _ct_tax_u.fam_u[las_w - 1].rod_u) ) {
+    las_w--;
+  }
+
+  {
+    c3_w bas_w = las_w;
+
+    while ( bas_w && (rod_u == _ct_tax_u.fam_u[bas_w - 1].rod_u) ) {
+      bas_w--;
+    }
+
+    for ( i_w = bas_w; i_w < las_w; i_w++ ) {
+      tax = u3nc(u3k(_ct_tax_u.fam_u[i_w].mon), tax);
+    }
+  }
+
+  return tax;
+}
+
 /* u3t_push(): push on trace stack.
 */
 void
 u3t_push(u3_noun mon)
 {
-  u3R->bug.tax = u3nc(mon, u3R->bug.tax);
+  _ct_fram_push(mon, c3y);
+}
+
+/* u3t_lend(): push on trace stack, without retaining [mon].
+*/
+void
+u3t_lend(u3_noun mon)
+{
+  _ct_fram_push(mon, c3n);
 }
 
 /* u3t_mean(): push `[%mean roc]` on trace stack.
@@ -23,7 +112,7 @@ u3t_push(u3_noun mon)
 void
 u3t_mean(u3_noun roc)
 {
-  u3R->bug.tax = u3nc(u3nc(c3__mean, roc), u3R->bug.tax);
+  _ct_fram_push(u3nc(c3__mean, roc), c3y);
 }
 
 /* u3t_drop(): drop from meaning stack.
@@ -31,6 +120,19 @@ u3t_mean(u3_noun roc)
 void
 u3t_drop(void)
 {
+  if (  _ct_tax_u.len_w
+     && (u3R == _ct_tax_u.fam_u[_ct_tax_u.len_w - 1].rod_u) )
+  {
+    _ct_fram* fam_u = &(_ct_tax_u.fam_u[--_ct_tax_u.len_w]);
+
+    if ( c3y == fam_u->own_o ) {
+      u3z(fam_u->mon);
+    }
+    return;
+  }
+
+  //  already materialized (see u3t_flush())
+  //
   c3_assert(_(u3du(u3R->bug.tax)));
   {
     u3_noun tax = u3R->bug.tax;
@@ -40,6 +142,28 @@ u3t_drop(void)
   }
 }
 
+/* u3t_flush(): materialize the current road's trace into bug.tax.
+*/
+void
+u3t_flush(void)
+{
+  c3_w las_w = _ct_tax_u.len_w;
+  c3_w bas_w = _ct_fram_base(u3R);
+  c3_w   i_w;
+
+  //  pop first: if we're out of memory, the nested bail
+  //  must not find these frames again
+  //
+  _ct_tax_u.len_w = bas_w;
+
+  for ( i_w = bas_w; i_w < las_w; i_w++ ) {
+    _ct_fram* fam_u = &(_ct_tax_u.fam_u[i_w]);
+    u3_noun     mon = ( c3y == fam_u->own_o ) ? fam_u->mon : u3k(fam_u->mon);
+
+    u3R->bug.tax = u3nc(mon, u3R->bug.tax);
+  }
+}
+
 /* u3t_slog(): print directly.
 */
 void
@@ -646,7 +770,7 @@ u3t_slog_trace(c3_l pri_l, u3_noun tax)
 void
 u3t_slog_nara(c3_l pri_l)
 {
-  u3_noun tax = u3k(u3R->bug.tax);
+  u3_noun tax = _ct_tax(u3R);
   u3t_slog_trace(pri_l, tax);
 }
 
@@ -661,13 +785,13 @@ u3t_slog_hela(c3_l pri_l)
   u3_road* rod_u = u3R;
 
   // inits to the the current road's trace
-  u3_noun tax = u3k(rod_u->bug.tax);
+  u3_noun tax = _ct_tax(rod_u);
 
   // while there is a parent road ref ...
   while ( &(u3H->rod_u) != rod_u ) {
     // ... point at the next road and append its stack to tax
     rod_u = u3tn(u3_road, rod_u->par_p);
-    tax = u3kb_weld(tax, u3k(rod_u->bug.tax));
+    tax = u3kb_weld(tax, _ct_tax(rod_u));
   }
 
   u3t_slog_trace(pri_l, tax);
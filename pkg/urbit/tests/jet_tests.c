@@ -347,6 +347,172 @@ _test_base16(void)
   return ret_i;
 }
 
+static c3_i
+_b64_en_good(c3_o pad, c3_o url, c3_w len_w, const c3_c* dat_c, const c3_c* exp_c)
+{
+  u3_atom dat = u3i_bytes(len_w, (c3_y*)dat_c);
+  u3_atom pro = u3qe_en_base64(pad, url, len_w, dat);
+  u3_atom exp = u3i_string(exp_c);
+  c3_i  ret_i = 1;
+
+  if ( c3n == u3r_sing(pro, exp) ) {
+    fprintf(stderr, "en_base64: %s wrong\r\n", exp_c);
+    ret_i = 0;
+  }
+
+  u3z(dat); u3z(pro); u3z(exp);
+  return ret_i;
+}
+
+static c3_i
+_b64_de_good(c3_o pad, c3_o url, const c3_c* inp_c, c3_w len_w, u3_atom dat)
+{
+  u3_atom inp = u3i_string(inp_c);
+  u3_noun pro = u3qe_de_base64(pad, url, inp);
+  u3_noun exp = u3nt(u3_nul, len_w, dat);
+  c3_i  ret_i = 1;
+
+  if ( (u3_none == pro) || (c3n == u3r_sing(pro, exp)) ) {
+    fprintf(stderr, "de_base64: %s wrong\r\n", inp_c);
+    ret_i = 0;
+  }
+
+  u3z(inp); u3z(pro); u3z(exp);
+  return ret_i;
+}
+
+static c3_i
+_test_base64(void)
+{
+  c3_i ret_i = 1;
+
+  ret_i &= _b64_en_good(c3y, c3n, 0, "", "");
+  ret_i &= _b64_en_good(c3y, c3n, 3, "abc", "YWJj");
+  ret_i &= _b64_en_good(c3y, c3n, 2, "ab", "YWI=");
+  ret_i &= _b64_en_good(c3n, c3n, 2, "ab", "YWI");
+  ret_i &= _b64_en_good(c3y, c3n, 4, "abcd", "YWJjZA==");
+  ret_i &= _b64_en_good(c3y, c3n, 2, "\xfb\xff", "+/8=");
+  ret_i &= _b64_en_good(c3y, c3y, 2, "\xfb\xff", "-_8=");
+  ret_i &= _b64_en_good(c3y, c3n, 2, "\x00\x41", "AEE=");
+
+  ret_i &= _b64_de_good(c3y, c3n, "YWJj", 3, u3i_string("abc"));
+  ret_i &= _b64_de_good(c3y, c3n, "YWJjZA==", 4, u3i_string("abcd"));
+  ret_i &= _b64_de_good(c3n, c3y, "-_8", 2, 0xfffb);
+  //  the hoon drops leading zero bytes
+  //
+  ret_i &= _b64_de_good(c3y, c3n, "AEE=", 2, 0x41);
+
+  {
+    u3_atom inp = u3i_string("YW Jj");
+    u3_noun pro = u3qe_de_base64(c3y, c3n, inp);
+
+    if ( u3_nul != pro ) {
+      fprintf(stderr, "de_base64: expected fail\r\n");
+      ret_i = 0;
+    }
+    u3z(inp); u3z(pro);
+  }
+
+  {
+    u3_atom inp = u3i_string("YWI");
+
+    if ( u3_none != u3qe_de_base64(c3y, c3n, inp) ) {
+      fprintf(stderr, "de_base64: expected punt\r\n");
+      ret_i = 0;
+    }
+    u3z(inp);
+  }
+
+  return ret_i;
+}
+
+static c3_i
+_json_de_good(const c3_c* txt_c, u3_noun val)
+{
+  u3_noun txt = u3i_string(txt_c);
+  u3_noun pro = u3qe_de_json(txt);
+  c3_i  ret_i = 1;
+
+  if ( (u3_nul == pro) || (c3n == u3r_sing(u3t(pro), val)) ) {
+    fprintf(stderr, "de_json: %s wrong\r\n", txt_c);
+    ret_i = 0;
+  }
+
+  u3z(txt); u3z(pro); u3z(val);
+  return ret_i;
+}
+
+static c3_i
+_json_de_fail(const c3_c* txt_c)
+{
+  u3_noun txt = u3i_string(txt_c);
+  u3_noun pro = u3qe_de_json(txt);
+  c3_i  ret_i = 1;
+
+  if ( u3_nul != pro ) {
+    fprintf(stderr, "de_json: %s expected fail\r\n", txt_c);
+    ret_i = 0;
+  }
+
+  u3z(txt); u3z(pro);
+  return ret_i;
+}
+
+static c3_i
+_json_en_good(u3_noun val, const c3_c* txt_c)
+{
+  u3_noun pro = u3qe_en_json(val);
+  u3_noun exp = u3i_tape(txt_c);
+  c3_i  ret_i = 1;
+
+  if ( c3n == u3r_sing(pro, exp) ) {
+    fprintf(stderr, "en_json: %s wrong\r\n", txt_c);
+    ret_i = 0;
+  }
+
+  u3z(val); u3z(pro); u3z(exp);
+  return ret_i;
+}
+
+static c3_i
+_test_json(void)
+{
+  c3_i ret_i = 1;
+
+  ret_i &= _json_de_good("null", u3_nul);
+  ret_i &= _json_de_good(" true\n", u3nc(c3__b, c3y));
+  ret_i &= _json_de_good("[1, -0.5e+3 ,\"a\"]",
+                         u3nc(c3__a, u3nt(u3nc(c3__n, '1'),
+                                          u3nc(c3__n, u3i_string("-0.5e+3")),
+                                          u3nc(u3nc(c3__s, 'a'), u3_nul))));
+  ret_i &= _json_de_good("[ ]", u3nc(c3__a, u3_nul));
+  ret_i &= _json_de_good("1.", u3nc(c3__n, u3i_string("1.")));
+  ret_i &= _json_de_good("\"\\u00e9\\n\\'\"",
+                         u3nc(c3__s, u3i_string("\xc3\xa9\n'")));
+  ret_i &= _json_de_good("\"a\\u0000b\"", u3nc(c3__s, u3i_string("ab")));
+  ret_i &= _json_de_good("{\"a\":1, \"a\" : 2}",
+                         u3nc(c3__o, u3kdb_put(u3_nul, 'a', u3nc(c3__n, '2'))));
+
+  ret_i &= _json_de_fail("");
+  ret_i &= _json_de_fail("01");
+  ret_i &= _json_de_fail("[1,]");
+  ret_i &= _json_de_fail("\"\\u00E9\"");
+  ret_i &= _json_de_fail("\"\x7f\"");
+  ret_i &= _json_de_fail("{\"a\" 1}");
+
+  ret_i &= _json_en_good(u3_nul, "null");
+  ret_i &= _json_en_good(u3nc(c3__a, u3nt(u3nc(c3__b, c3y),
+                                          u3nc(c3__n, u3i_string("12")),
+                                          u3_nul)),
+                         "[true,12]");
+  ret_i &= _json_en_good(u3nc(c3__s, u3i_string("a\"\\\n\x01")),
+                         "\"a\\\"\\\\\\n\\u0001\"");
+  ret_i &= _json_en_good(u3nc(c3__o, u3kdb_put(u3_nul, 'a', u3_nul)),
+                         "{\"a\":null}");
+
+  return ret_i;
+}
+
 static c3_w
 _fein_ob_w(c3_w inp_w)
 {
@@ -497,6 +663,753 @@ _test_ob(void)
   return ret_i;
 }
 
+static c3_i
+_test_by_own(void)
+{
+  c3_i    ret_i = 1;
+  u3_noun map   = u3_nul;
+  u3_noun old, ref;
+  c3_w    i_w;
+
+  for ( i_w = 0; i_w < 64; i_w++ ) {
+    map = u3kdb_put(map, i_w, i_w);
+  }
+
+  //  a shared map must not be changed under its other owner
+  //
+  old = u3k(map);
+  ref = u3qdb_put(old, 7, 70);
+  map = u3kdb_put(map, 7, 70);
+
+  if ( c3n == u3r_sing(ref, map) ) {
+    fprintf(stderr, "by_own: put mismatch\r\n");
+    ret_i = 0;
+  }
+
+  if ( 7 != u3kdb_got(u3k(old), 7) ) {
+    fprintf(stderr, "by_own: shared map changed\r\n");
+    ret_i = 0;
+  }
+
+  //  and an unshared one is changed in place
+  //
+  u3z(ref);
+  ref = u3qdb_del(map, 9);
+  map = u3kdb_del(map, 9);
+
+  if ( c3n == u3r_sing(ref, map) ) {
+    fprintf(stderr, "by_own: del mismatch\r\n");
+    ret_i = 0;
+  }
+
+  u3z(old); u3z(ref); u3z(map);
+  return ret_i;
+}
+
+static c3_i
+_tree_good(const c3_c* nam_c, u3_noun pro, u3_noun exp)
+{
+  c3_i ret_i = 1;
+
+  if ( c3n == u3r_sing(pro, exp) ) {
+    fprintf(stderr, "tree: %s wrong\r\n", nam_c);
+    ret_i = 0;
+  }
+
+  u3z(pro); u3z(exp);
+  return ret_i;
+}
+
+//  a hand-built tree (not a treap), nodes numbered from add_w:
+//
+//           1
+//         2   3
+//        4 5    6
+//
+static u3_noun
+_tree_six(c3_w add_w)
+{
+  u3_noun two = u3nt(2 + add_w, u3nt(4 + add_w, u3_nul, u3_nul),
+                                u3nt(5 + add_w, u3_nul, u3_nul));
+  u3_noun thr = u3nt(3 + add_w, u3_nul, u3nt(6 + add_w, u3_nul, u3_nul));
+
+  return u3nt(1 + add_w, two, thr);
+}
+
+static c3_i
+_test_tree_walk(void)
+{
+  c3_i    ret_i = 1;
+  u3_noun tre   = _tree_six(0);
+  u3_noun gat;
+
+  //  rightmost node first
+  //
+  ret_i &= _tree_good("tap", u3qdi_tap(tre), u3nl(6, 3, 1, 5, 2, 4, u3_none));
+  ret_i &= _tree_good("wyt", u3qdi_wyt(tre), 6);
+  ret_i &= _tree_good("tap ~", u3qdi_tap(u3_nul), u3_nul);
+
+  //  |=([n=@ a=(list @)] [n a]): records the order of its calls,
+  //  last first
+  //
+  gat = u3nt(u3nc(u3nc(0, 12), u3nc(0, 13)), u3nc(0, 0), 0);
+  ret_i &= _tree_good("rep", u3qdi_rep(tre, gat),
+                             u3nl(6, 3, 5, 4, 2, 1, u3_none));
+  ret_i &= _tree_good("rep ~", u3qdi_rep(u3_nul, gat), u3_nul);
+  u3z(gat);
+
+  //  |=([n=@ a=(list @)] [[n a] +(n)]): the same, and bumps each node
+  //
+  gat = u3nt(u3nc(u3nc(u3nc(0, 12), u3nc(0, 13)), u3nt(4, 0, 12)),
+             u3nc(0, 0),
+             0);
+  ret_i &= _tree_good("rib", u3qdb_rib(tre, 7, gat),
+                             u3nc(u3nt(6, 3, u3nq(5, 4, 2, u3nc(1, 7))),
+                                  _tree_six(1)));
+  ret_i &= _tree_good("rib ~", u3qdb_rib(u3_nul, 7, gat), u3nc(7, u3_nul));
+  u3z(gat);
+
+  u3z(tre);
+  return ret_i;
+}
+
+static c3_i
+_test_tree_dig(void)
+{
+  c3_i    ret_i = 1;
+  u3_noun key[20];
+  u3_noun set = u3_nul, map = u3_nul;
+  u3_noun pro;
+  c3_w    i_w, j_w;
+
+  //  keys in +gor order
+  //
+  for ( i_w = 0; i_w < 20; i_w++ ) {
+    u3_noun tmp = (i_w * i_w) + 1;
+
+    for ( j_w = i_w; j_w && (c3y == u3qc_gor(tmp, key[j_w - 1])); j_w-- ) {
+      key[j_w] = key[j_w - 1];
+    }
+    key[j_w] = tmp;
+  }
+
+  //  a right spine, so the last key's axis needs more than 31 bits
+  //
+  for ( i_w = 20; i_w--; ) {
+    set = u3nt(key[i_w], u3_nul, set);
+    map = u3nt(u3nc(key[i_w], i_w), u3_nul, map);
+  }
+
+  for ( i_w = 0; i_w < 20; i_w++ ) {
+    pro = u3qdi_dig(set, key[i_w]);
+
+    if (  (u3_nul == pro)
+       || (c3n == u3r_sing(key[i_w], u3r_at(u3t(pro), set))) )
+    {
+      fprintf(stderr, "tree: dig:in %u wrong\r\n", key[i_w]);
+      ret_i = 0;
+    }
+    else if ( (19 == i_w) && (c3y == u3a_is_cat(u3t(pro))) ) {
+      fprintf(stderr, "tree: dig:in axis direct\r\n");
+      ret_i = 0;
+    }
+    u3z(pro);
+
+    pro = u3qdb_dig(map, key[i_w]);
+
+    if (  (u3_nul == pro)
+       || (c3n == u3r_sing(key[i_w], u3h(u3r_at(u3t(pro), map)))) )
+    {
+      fprintf(stderr, "tree: dig:by %u wrong\r\n", key[i_w]);
+      ret_i = 0;
+    }
+    u3z(pro);
+  }
+
+  //  absent keys
+  //
+  ret_i &= _tree_good("dig:in absent", u3qdi_dig(set, 1000), u3_nul);
+  ret_i &= _tree_good("dig:by absent", u3qdb_dig(map, 1000), u3_nul);
+  ret_i &= _tree_good("dig:in ~", u3qdi_dig(u3_nul, 1), u3_nul);
+
+  u3z(set); u3z(map);
+  return ret_i;
+}
+
+//  the set of the keys of [a], in the same shape
+//
+static u3_noun
+_gas_keys(u3_noun a)
+{
+  if ( u3_nul == a ) {
+    return u3_nul;
+  }
+  else {
+    u3_noun n_a, l_a, r_a;
+    u3x_trel(a, &n_a, &l_a, &r_a);
+    return u3nt(u3k(u3h(n_a)), _gas_keys(l_a), _gas_keys(r_a));
+  }
+}
+
+//  [a] mirrored
+//
+static u3_noun
+_gas_flip(u3_noun a)
+{
+  if ( u3_nul == a ) {
+    return u3_nul;
+  }
+  else {
+    u3_noun n_a, l_a, r_a;
+    u3x_trel(a, &n_a, &l_a, &r_a);
+    return u3nt(u3k(n_a), _gas_flip(r_a), _gas_flip(l_a));
+  }
+}
+
+//  gas:by and gas:in must produce exactly what +put would, one item
+//  at a time. the list has [len_w] items, and item i has the key
+//  ((i mod mod_w) * sed_w) + 1. the set is the keys of [a].
+//
+static c3_i
+_gas_good(const c3_c* nam_c, u3_noun a, c3_w len_w, c3_w mod_w, c3_w sed_w)
+{
+  c3_i    ret_i = 1;
+  u3_noun set, lis = u3_nul, sel = u3_nul;
+  u3_noun ref, pro, i_b, t_b;
+  c3_w    i_w;
+
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    c3_w key_w = ((i_w % mod_w) * sed_w) + 1;
+
+    lis = u3nc(u3nc(key_w, i_w), lis);
+    sel = u3nc(key_w, sel);
+  }
+
+  set = _gas_keys(a);
+
+  ref = u3k(a);
+  for ( t_b = lis; u3_nul != t_b; t_b = u3t(t_b) ) {
+    i_b = u3h(t_b);
+    pro = u3qdb_put(ref, u3h(i_b), u3t(i_b));
+    u3z(ref);
+    ref = pro;
+  }
+
+  if ( c3n == u3r_sing(ref, pro = u3qdb_gas(a, lis)) ) {
+    fprintf(stderr, "gas: by %s wrong\r\n", nam_c);
+    ret_i = 0;
+  }
+  u3z(pro); u3z(ref);
+
+  ref = u3k(set);
+  for ( t_b = sel; u3_nul != t_b; t_b = u3t(t_b) ) {
+    pro = u3qdi_put(ref, u3h(t_b));
+    u3z(ref);
+    ref = pro;
+  }
+
+  if ( c3n == u3r_sing(ref, pro = u3qdi_gas(set, sel)) ) {
+    fprintf(stderr, "gas: in %s wrong\r\n", nam_c);
+    ret_i = 0;
+  }
+  u3z(pro); u3z(ref);
+
+  u3z(set); u3z(lis); u3z(sel);
+  return ret_i;
+}
+
+static c3_i
+_test_gas(void)
+{
+  c3_i    ret_i = 1;
+  u3_noun sma   = u3_nul, big = u3_nul, bad;
+  c3_w    i_w;
+
+  for ( i_w = 0; i_w < 100; i_w++ ) {
+    sma = u3kdb_put(sma, (i_w * 3) + 1, 1000 + i_w);
+  }
+
+  for ( i_w = 0; i_w < 400; i_w++ ) {
+    big = u3kdb_put(big, (i_w * 3) + 1, 1000 + i_w);
+  }
+
+  //  around the bulk minimum (16), with the last duplicate winning
+  //
+  ret_i &= _gas_good("15", u3_nul, 15, 15, 7);
+  ret_i &= _gas_good("16", u3_nul, 16, 16, 7);
+  ret_i &= _gas_good("dups", u3_nul, 40, 13, 7);
+
+  //  into a tree of 100 (bulk), or of 400 (more than 8x the list),
+  //  with keys in both
+  //
+  ret_i &= _gas_good("merge", sma, 40, 25, 2);
+  ret_i &= _gas_good("large", big, 20, 20, 2);
+
+  //  a mirrored treap is out of +gor order, so must be put into
+  //  one item at a time
+  //
+  {
+    u3_noun tre = u3_nul;
+
+    for ( i_w = 0; i_w < 12; i_w++ ) {
+      tre = u3kdb_put(tre, (i_w * 5) + 1, i_w);
+    }
+
+    bad = _gas_flip(tre);
+    u3z(tre);
+  }
+  ret_i &= _gas_good("bad", bad, 20, 20, 5);
+
+  u3z(sma); u3z(big); u3z(bad);
+  return ret_i;
+}
+
+static c3_i
+_sort_good(const c3_c* nam_c, u3_noun pro, u3_noun exp)
+{
+  c3_i ret_i = 1;
+
+  if ( c3n == u3r_sing(pro, exp) ) {
+    fprintf(stderr, "sort: %s wrong\r\n", nam_c);
+    ret_i = 0;
+  }
+
+  u3z(pro); u3z(exp);
+  return ret_i;
+}
+
+static c3_i
+_test_sort(void)
+{
+  c3_i    ret_i = 1;
+  u3_noun lis, exp, gat;
+  c3_w    i_w;
+
+  //  |=([c=[@ *] d=[@ *]] (lth -.c -.d)), for heads below 3
+  //
+  gat = u3nt(u3nq(6, u3nt(5, u3nc(1, 0), u3nc(0, 24)),
+                     u3nq(6, u3nt(5, u3nc(1, 0), u3nc(0, 26)),
+                             u3nc(1, 1),
+                             u3nc(1, 0)),
+                     u3nq(6, u3nt(5, u3nc(1, 1), u3nc(0, 24)),
+                             u3nt(5, u3nc(1, 2), u3nc(0, 26)),
+                             u3nc(1, 1))),
+             u3nc(0, 0),
+             0);
+
+  //  equal heads keep their order
+  //
+  lis = u3_nul;
+  exp = u3_nul;
+
+  for ( i_w = 30; i_w--; ) {
+    lis = u3nc(u3nc((i_w * 7) % 3, i_w), lis);
+  }
+
+  {
+    c3_w j_w;
+
+    for ( j_w = 3; j_w--; ) {
+      for ( i_w = 30; i_w--; ) {
+        if ( j_w == ((i_w * 7) % 3) ) {
+          exp = u3nc(u3nc(j_w, i_w), exp);
+        }
+      }
+    }
+  }
+
+  ret_i &= _sort_good("stable", u3qb_sort(lis, gat), exp);
+  u3z(lis);
+  u3z(gat);
+
+  //  |=([c=[@ *] *] =(2 -.c)), which ignores the pivot:
+  //
+  //    (sort ~[[1 %a] [2 %b] [3 %c] [2 %d] [4 %e]] gat)
+  //    ~[[2 %d] [2 %b] [1 %a] [3 %c] [4 %e]]
+  //
+  gat = u3nt(u3nt(5, u3nc(1, 2), u3nc(0, 24)), u3nc(0, 0), 0);
+  lis = u3nl(u3nc(1, 'a'), u3nc(2, 'b'), u3nc(3, 'c'),
+             u3nc(2, 'd'), u3nc(4, 'e'), u3_none);
+  exp = u3nl(u3nc(2, 'd'), u3nc(2, 'b'), u3nc(1, 'a'),
+             u3nc(3, 'c'), u3nc(4, 'e'), u3_none);
+
+  ret_i &= _sort_good("pivotless", u3qb_sort(lis, gat), exp);
+  u3z(lis);
+  u3z(gat);
+
+  //  |=(* &) reverses; |=(* |) keeps the order, partitioning a long
+  //  list into nothing and the rest at every step
+  //
+  lis = u3_nul;
+  exp = u3_nul;
+
+  for ( i_w = 2000; i_w--; ) {
+    lis = u3nc(i_w, lis);
+  }
+  for ( i_w = 0; i_w < 2000; i_w++ ) {
+    exp = u3nc(i_w, exp);
+  }
+
+  gat = u3nt(u3nc(1, c3y), u3nc(0, 0), 0);
+  ret_i &= _sort_good("yes", u3qb_sort(lis, gat), exp);
+  u3z(gat);
+
+  gat = u3nt(u3nc(1, c3n), u3nc(0, 0), 0);
+  ret_i &= _sort_good("no", u3qb_sort(lis, gat), u3k(lis));
+  u3z(gat);
+
+  u3z(lis);
+  return ret_i;
+}
+
+static c3_i
+_text_good(const c3_c* nam_c, u3_noun pro, u3_noun exp)
+{
+  c3_i ret_i = 1;
+
+  if ( c3n == u3r_sing(pro, exp) ) {
+    fprintf(stderr, "text: %s wrong\r\n", nam_c);
+    ret_i = 0;
+  }
+
+  u3z(pro); u3z(exp);
+  return ret_i;
+}
+
+static c3_i
+_arith_good(const c3_c* nam_c, u3_noun pro, u3_noun exp)
+{
+  c3_i ret_i = 1;
+
+  if ( c3n == u3r_sing(pro, exp) ) {
+    fprintf(stderr, "arith: %s wrong\r\n", nam_c);
+    ret_i = 0;
+  }
+
+  u3z(pro); u3z(exp);
+  return ret_i;
+}
+
+static c3_i
+_test_chub_ops(void)
+{
+  c3_i    ret_i = 1;
+  u3_atom max   = u3i_chub(0xffffffffffffffffULL);
+  u3_atom wor   = u3i_word(0xffffffff);
+  u3_atom big   = u3i_chub(0x100000000ULL);
+  u3_atom num   = u3i_chub(0x123456789aULL);
+
+  //  carries and borrows across the word and chub boundaries
+  //
+  ret_i &= _arith_good("add carry", u3qa_add(max, 1), u3qc_bex(64));
+  ret_i &= _arith_good("add word", u3qa_add(wor, 1), u3k(big));
+  ret_i &= _arith_good("sub borrow", u3qa_sub(big, 1), u3k(wor));
+
+  //  full 128-bit products
+  //
+  {
+    c3_d    sq_d[2] = { 1, 0xfffffffffffffffeULL };
+    c3_d    pq_d[2] = { 0x236d88fe5618cf00ULL, 0x121fa00ad77d7422ULL };
+    u3_atom p = u3i_chub(0x123456789abcdef0ULL);
+    u3_atom q = u3i_chub(0xfedcba9876543210ULL);
+
+    ret_i &= _arith_good("mul max", u3qa_mul(max, max), u3i_chubs(2, sq_d));
+    ret_i &= _arith_good("mul", u3qa_mul(p, q), u3i_chubs(2, pq_d));
+    u3z(p); u3z(q);
+  }
+
+  ret_i &= _arith_good("div", u3qa_div(max, 3),
+                       u3i_chub(0x5555555555555555ULL));
+  ret_i &= _arith_good("mod", u3qa_mod(max, big), u3k(wor));
+  ret_i &= _arith_good("dvr", u3qc_dvr(max, big), u3nc(u3k(wor), u3k(wor)));
+
+  //  shifts to exactly 64 bits, and just past
+  //
+  {
+    c3_d lon_d[2] = { 0xfffffffe00000000ULL, 1 };
+
+    ret_i &= _arith_good("lsh 64", u3qc_lsh(0, 32, wor),
+                         u3i_chub(0xffffffff00000000ULL));
+    ret_i &= _arith_good("lsh 65", u3qc_lsh(0, 33, wor), u3i_chubs(2, lon_d));
+  }
+  ret_i &= _arith_good("rsh", u3qc_rsh(0, 31, max), u3i_chub(0x1ffffffffULL));
+
+  //  cut and end across the word boundary
+  //
+  ret_i &= _arith_good("cut bits", u3qc_cut(0, 28, 8, num), 0x23);
+  ret_i &= _arith_good("cut bytes", u3qc_cut(3, 3, 2, num), 0x1234);
+  ret_i &= _arith_good("end", u3qc_end(0, 36, num), u3i_chub(0x23456789aULL));
+  ret_i &= _arith_good("met bits", u3qc_met(0, max), 64);
+  ret_i &= _arith_good("met bytes", u3qc_met(3, num), 5);
+
+  //  comparisons of equal-length atoms, differing in either word
+  //
+  {
+    u3_atom a = u3i_chub(0x100000001ULL);
+    u3_atom b = u3i_chub(0x100000002ULL);
+    u3_atom c = u3i_chub(0x200000000ULL);
+    u3_atom d = u3i_chub(0x1ffffffffULL);
+
+    ret_i &= _arith_good("lth low", u3qa_lth(a, b), c3y);
+    ret_i &= _arith_good("gth low", u3qa_gth(a, b), c3n);
+    ret_i &= _arith_good("gth high", u3qa_gth(c, d), c3y);
+    ret_i &= _arith_good("lth high", u3qa_lth(c, d), c3n);
+    ret_i &= _arith_good("lte same", u3qa_lte(a, a), c3y);
+    ret_i &= _arith_good("gte same", u3qa_gte(d, d), c3y);
+    ret_i &= _arith_good("gte high", u3qa_gte(d, c), c3n);
+    u3z(a); u3z(b); u3z(c); u3z(d);
+  }
+
+  u3z(max); u3z(wor); u3z(big); u3z(num);
+  return ret_i;
+}
+
+//  multi-word operands, checked against GMP on copies of the atoms
+//
+static u3_atom
+_mp_atom(c3_w len_w, c3_w sed_w)
+{
+  c3_w*   buf_w = c3_malloc(len_w * sizeof(c3_w));
+  u3_atom pro;
+  c3_w    i_w;
+
+  for ( i_w = 0; i_w < len_w; i_w++ ) {
+    sed_w      = (sed_w * 1103515245) + 12345;
+    buf_w[i_w] = sed_w | ( (i_w + 1 == len_w) ? 0x80000000 : 0 );
+  }
+
+  pro = u3i_words(len_w, buf_w);
+  c3_free(buf_w);
+  return pro;
+}
+
+static c3_i
+_mp_pair_good(c3_w a_w, c3_w b_w)
+{
+  u3_atom a = _mp_atom(a_w, a_w);
+  u3_atom b = _mp_atom(b_w, 7 * b_w);
+  c3_i    ret_i = 1;
+  mpz_t   a_mp, b_mp, c_mp, d_mp;
+
+  u3r_mp(a_mp, a);
+  u3r_mp(b_mp, b);
+  mpz_init(c_mp);
+  mpz_init(d_mp);
+
+  mpz_mul(c_mp, a_mp, b_mp);
+  ret_i &= _arith_good("mp mul", u3qa_mul(a, b), u3i_mp(c_mp));
+
+  mpz_init(c_mp);
+  mpz_tdiv_qr(c_mp, d_mp, a_mp, b_mp);
+  {
+    u3_atom quo = u3i_mp(c_mp);
+    u3_atom rem = u3i_mp(d_mp);
+
+    ret_i &= _arith_good("mp div", u3qa_div(a, b), u3k(quo));
+    ret_i &= _arith_good("mp mod", u3qa_mod(a, b), u3k(rem));
+    ret_i &= _arith_good("mp dvr", u3qc_dvr(a, b), u3nc(quo, rem));
+  }
+
+  mpz_init(c_mp);
+  mpz_init(d_mp);
+  mpz_sqrtrem(c_mp, d_mp, a_mp);
+  {
+    u3_atom sqt = u3i_mp(c_mp);
+    u3_atom rem = u3i_mp(d_mp);
+
+    ret_i &= _arith_good("mp sqt", u3qc_sqt(a), u3nc(sqt, rem));
+  }
+
+  if ( !ret_i ) {
+    fprintf(stderr, "mp: %u by %u words\r\n", a_w, b_w);
+  }
+
+  mpz_clear(a_mp);
+  mpz_clear(b_mp);
+  u3z(a); u3z(b);
+  return ret_i;
+}
+
+static c3_i
+_test_mp_ops(void)
+{
+  c3_i ret_i = 1;
+
+  //  odd word lengths are read through copied views; a dividend
+  //  shorter than the divisor takes the early returns
+  //
+  ret_i &= _mp_pair_good(3, 3);
+  ret_i &= _mp_pair_good(5, 3);
+  ret_i &= _mp_pair_good(7, 2);
+  ret_i &= _mp_pair_good(4, 2);
+  ret_i &= _mp_pair_good(6, 5);
+  ret_i &= _mp_pair_good(3, 5);
+  ret_i &= _mp_pair_good(2, 4);
+
+  //  a perfect square leaves no remainder limbs at all,
+  //  and one more leaves a remainder much shorter than the square
+  //
+  {
+    u3_atom a = _mp_atom(5, 11);
+    u3_atom b = u3qa_mul(a, a);
+    u3_atom c = u3qa_inc(b);
+
+    ret_i &= _arith_good("mp sqt square", u3qc_sqt(b), u3nc(u3k(a), 0));
+    ret_i &= _arith_good("mp sqt square+1", u3qc_sqt(c), u3nc(u3k(a), 1));
+    u3z(a); u3z(b); u3z(c);
+  }
+
+  return ret_i;
+}
+
+static c3_i
+_loss_good(const c3_c* hel_c, const c3_c* hev_c, const c3_c* exp_c)
+{
+  u3_noun hel = u3i_tape(hel_c);
+  u3_noun hev = u3i_tape(hev_c);
+  u3_noun pro = u3qe_loss(hel, hev);
+  u3_noun exp = u3i_tape(exp_c);
+  c3_i  ret_i = 1;
+
+  if ( c3n == u3r_sing(pro, exp) ) {
+    fprintf(stderr, "loss: %s %s wrong\r\n", hel_c, hev_c);
+    ret_i = 0;
+  }
+
+  u3z(hel); u3z(hev); u3z(pro); u3z(exp);
+  return ret_i;
+}
+
+static c3_i
+_test_loss(void)
+{
+  c3_i ret_i = 1;
+
+  //  outputs of the recursive definition; where several common
+  //  subsequences are longest, the arm's tie-break picks one
+  //
+  ret_i &= _loss_good("", "abc", "");
+  ret_i &= _loss_good("abcbdab", "bdcaba", "bdab");
+  ret_i &= _loss_good("abab", "aabba", "aab");
+  ret_i &= _loss_good("aaa", "abababa", "aaa");
+
+  //  with a common prefix
+  //
+  ret_i &= _loss_good("abcdef", "abcdef", "abcdef");
+  ret_i &= _loss_good("abcxyz", "abcyzq", "abcyz");
+  ret_i &= _loss_good("prefixab", "prefixba", "prefixb");
+  ret_i &= _loss_good("xyzabcb", "xyzbbcab", "xyzbcb");
+
+  return ret_i;
+}
+
+static u3_noun
+_text_tuba(u3_noun a)
+{
+  u3_noun pro = u3qe_tuba(a);
+  u3z(a);
+  return pro;
+}
+
+static u3_noun
+_text_tufa(u3_noun a)
+{
+  u3_noun pro = u3qe_tufa(a);
+  u3z(a);
+  return pro;
+}
+
+static u3_noun
+_text_cass(u3_noun a)
+{
+  u3_noun pro = u3qe_cass(a);
+  u3z(a);
+  return pro;
+}
+
+static u3_noun
+_text_trim(u3_noun a)
+{
+  u3_noun pro = u3qe_trim(u3h(a), u3t(a));
+  u3z(a);
+  return pro;
+}
+
+static c3_i
+_text_fail(const c3_c* nam_c, u3_funk fun_f, u3_noun arg)
+{
+  u3_noun pro = u3m_soft(0, fun_f, arg);
+  c3_i  ret_i = 1;
+
+  if ( u3_blip == u3h(pro) ) {
+    fprintf(stderr, "text: %s expected fail\r\n", nam_c);
+    ret_i = 0;
+  }
+
+  u3z(pro);
+  return ret_i;
+}
+
+static c3_i
+_test_text(void)
+{
+  c3_i    ret_i = 1;
+  u3_noun tap   = u3i_tape("Hello, World");
+  u3_noun utf   = u3i_tape("a\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80");
+  u3_noun chr   = u3nq('a', 0xe9, 0x20ac, u3nc(0x1f600, u3_nul));
+
+  ret_i &= _text_good("cass", u3qe_cass(tap), u3i_tape("hello, world"));
+  ret_i &= _text_good("cuss", u3qe_cuss(tap), u3i_tape("HELLO, WORLD"));
+  ret_i &= _text_good("crip", u3qe_crip(tap), u3i_string("Hello, World"));
+  ret_i &= _text_good("trim", u3qe_trim(5, tap),
+                      u3nc(u3i_tape("Hello"), u3i_tape(", World")));
+  ret_i &= _text_good("trim", u3qe_trim(99, tap), u3nc(u3k(tap), u3_nul));
+  ret_i &= _text_good("tuba", u3qe_tuba(utf), u3k(chr));
+  ret_i &= _text_good("tufa", u3qe_tufa(chr), u3k(utf));
+
+  //  an unchanged tape is shared, not copied
+  //
+  {
+    u3_noun low = u3i_tape("hello");
+    u3_noun pro = u3qe_cass(low);
+
+    if ( low != pro ) {
+      fprintf(stderr, "text: cass copied\r\n");
+      ret_i = 0;
+    }
+    u3z(low); u3z(pro);
+  }
+
+  //  tuba crashes wherever +teff and +taft do
+  //
+  ret_i &= _text_fail("tuba overlong", _text_tuba, u3i_tape("\xc1\x81"));
+  ret_i &= _text_fail("tuba continuation", _text_tuba, u3i_tape("a\x80" "b"));
+  ret_i &= _text_fail("tuba control", _text_tuba, u3i_tape("a\tb"));
+  ret_i &= _text_fail("tuba truncated", _text_tuba, u3i_tape("a\xe2\x82"));
+  ret_i &= _text_fail("tuba zero", _text_tuba,
+                      u3nt('a', 0x100, u3_nul));
+
+  //  and the others on lists that aren't tapes
+  //
+  ret_i &= _text_fail("cass improper", _text_cass, u3nt('A', 'b', 5));
+  ret_i &= _text_fail("cass cell", _text_cass, u3nt('A', u3nc(1, 2), u3_nul));
+  ret_i &= _text_fail("tufa improper", _text_tufa, u3nt('a', 'b', 5));
+  ret_i &= _text_fail("trim improper", _text_trim, u3nt(3, 'a', 5));
+
+  //  but trim doesn't look past the elements it takes
+  //
+  {
+    u3_noun lis = u3nt('a', 'b', 5);
+
+    ret_i &= _text_good("trim short", u3qe_trim(1, lis),
+                        u3nc(u3nc('a', u3_nul), u3nc('b', 5)));
+    u3z(lis);
+  }
+
+  u3z(tap); u3z(utf); u3z(chr);
+  return ret_i;
+}
+
 static c3_i
 _test_jets(void)
 {
@@ -512,6 +1425,61 @@ _test_jets(void)
     ret_i = 0;
   }
 
+  if ( !_test_base64() ) {
+    fprintf(stderr, "test jets: base64: failed\r\n");
+    ret_i = 0;
+  }
+
+  if ( !_test_json() ) {
+    fprintf(stderr, "test jets: json: failed\r\n");
+    ret_i = 0;
+  }
+
+  if ( !_test_chub_ops() ) {
+    fprintf(stderr, "test jets: chub ops: failed\r\n");
+    ret_i = 0;
+  }
+
+  if ( !_test_mp_ops() ) {
+    fprintf(stderr, "test jets: mp ops: failed\r\n");
+    ret_i = 0;
+  }
+
+  if ( !_test_loss() ) {
+    fprintf(stderr, "test jets: loss: failed\r\n");
+    ret_i = 0;
+  }
+
+  if ( !_test_text() ) {
+    fprintf(stderr, "test jets: text: failed\r\n");
+    ret_i = 0;
+  }
+
+  if ( !_test_tree_walk() ) {
+    fprintf(stderr, "test jets: tree walk: failed\r\n");
+    ret_i = 0;
+  }
+
+  if ( !_test_tree_dig() ) {
+    fprintf(stderr, "test jets: tree dig: failed\r\n");
+    ret_i = 0;
+  }
+
+  if ( !_test_gas() ) {
+    fprintf(stderr, "test jets: gas: failed\r\n");
+    ret_i = 0;
+  }
+
+  if ( !_test_sort() ) {
+    fprintf(stderr, "test jets: sort: failed\r\n");
+    ret_i = 0;
+  }
+
+  if ( !_test_by_own() ) {
+    fprintf(stderr, "test jets: by_own: failed\r\n");
+    ret_i = 0;
+  }
+
   if ( !_test_ob() ) {
     fprintf(stderr, "test jets: ob: failed\r\n");
     ret_i = 0;
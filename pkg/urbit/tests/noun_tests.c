@@ -1679,6 +1679,65 @@ _test_lily()
   }
 }
 
+/* _test_prof_nock(): nock a formula against a null subject.
+*/
+static u3_noun
+_test_prof_nock(u3_noun fol)
+{
+  return u3n_nock_on(u3_nul, u3k(fol));
+}
+
+/* _test_prof(): test that a crash stops charging the crashed program.
+*/
+static void
+_test_prof()
+{
+  u3_noun bad = u3nc(0, 2);
+  c3_l    mug_l = u3r_mug(bad);
+  u3_noun pro, pog;
+  c3_d    tim_d = 0;
+  c3_o    fon_o = c3n;
+
+  u3C.wag_w |= u3o_debug_cpu;
+  u3z(u3n_prof());
+
+  pro = u3m_soft(0, _test_prof_nock, u3k(bad));
+
+  if ( 0 == u3h(pro) ) {
+    printf("*** fail _test_prof-1\n");
+    exit(1);
+  }
+  u3z(pro);
+
+  //  anything still charging the crashed program would get this
+  //
+  usleep(50000);
+  u3z(u3n_nock_on(u3_nul, u3nc(1, 42)));
+
+  pro = u3n_prof();
+
+  for ( pog = u3h(u3t(pro)); u3_nul != pog; pog = u3t(pog) ) {
+    if ( mug_l == u3h(u3h(pog)) ) {
+      fon_o = c3y;
+      tim_d = u3r_chub(0, u3t(u3t(u3t(u3t(u3h(pog))))));
+    }
+  }
+
+  u3z(pro);
+  u3z(bad);
+  u3C.wag_w &= ~u3o_debug_cpu;
+
+  if ( c3n == fon_o ) {
+    printf("*** fail _test_prof-2\n");
+    exit(1);
+  }
+
+  if ( tim_d >= 25000000ULL ) {
+    printf("*** fail _test_prof-3: %" PRIu64 "ns\n", tim_d);
+    exit(1);
+  }
+}
+
 /* main(): run all test cases.
 */
 int
@@ -1699,6 +1758,7 @@ main(int argc, char* argv[])
   _test_u3r_at();
   _test_nvm_stack();
   _test_lily();
+  _test_prof();
 
   fprintf(stderr, "test_noun: ok\n");
 
@@ -78,6 +78,36 @@
 **  rendered as 'pier-ames-packets-sent'. this transformation is
 **  guaranteed to result in unique names.
 **
+**  /nock produces the most recently saved bytecode profile, if the
+**  ship is running with profiling (-P). the serf saves after an
+**  event, at most every ten seconds, so a profile covers all events
+**  since the previous save: up to about ten seconds of events. it
+**  is produced as:
+**
+**      $:  eve=@ud                                       ::  last event
+**          ops=(list [@tas @ud])                         ::  dispatches
+**          pog=(list [mug=@ux lab=(unit [path @ud]) ent=@ud ops=@ud tim=@ud])
+**          unj=(list [lab=[path @ud] ent=@ud tim=@ud])   ::  unjetted arms
+**      ==                                                ::
+**
+**  ranked by exclusive burn time (ns). formulas are labelled with
+**  the jet dashboard path and arm axis of a core that calls them,
+**  where one is known. unj lists the hottest arms of registered
+**  cores that ran in nock for want of a jet driver: candidates
+**  for new jets.
+**
+**  /jets produces the jet arm metrics since the serf started, as
+**  of the most recent |mass or (when profiling) the most recent
+**  profile save, as:
+**
+**      [eve=@ud mass]
+**
+**  where eve is the last event before that |mass or save, and there
+**  is one $mass per called arm, named by its jet dashboard path,
+**  counting calls, time in the jet (ns, only when profiling), punts
+**  back to nock, and test-mode mismatches. arms are ranked by time,
+**  then calls.
+**
 **  %ovum is a raw kernel move, to be injected directly into
 **  arvo. needless to say this will void your warranty. usually
 **  you want to use %fyrd instead. an update will be sent: %done
@@ -429,6 +459,40 @@ _conn_ovum_news(u3_ovum* egg_u, u3_ovum_news new_e)
   }
 }
 
+/* _conn_peel_put(): serf output in .urb/put/<nam>.jam, if any.
+*/
+static u3_noun
+_conn_peel_put(u3_conn* con_u, const c3_c* nam_c)
+{
+  u3_pier*    pir_u = con_u->car_u.pir_u;
+  c3_c        pat_c[2048];
+  struct stat buf_u;
+  c3_i        fid_i;
+  c3_y*       byt_y;
+  u3_weak     jar = u3_none;
+
+  snprintf(pat_c, 2048, "%s/.urb/put/%s.jam", pir_u->pax_c, nam_c);
+
+  if ( 0 > (fid_i = c3_open(pat_c, O_RDONLY, 0644)) ) {
+    return u3_nul;
+  }
+  else if ( (0 > fstat(fid_i, &buf_u)) || (0 == buf_u.st_size) ) {
+    close(fid_i);
+    return u3_nul;
+  }
+
+  byt_y = c3_malloc(buf_u.st_size);
+
+  if ( buf_u.st_size == read(fid_i, byt_y, buf_u.st_size) ) {
+    jar = u3s_cue_xeno_with(con_u->sil_u, buf_u.st_size, byt_y);
+  }
+
+  close(fid_i);
+  c3_free(byt_y);
+
+  return ( u3_none == jar ) ? u3_nul : u3nc(u3_nul, jar);
+}
+
 /* _conn_read_peel(): response to a %peel request, sans rid.
 */
 static u3_noun
@@ -454,8 +518,9 @@ _conn_read_peel(u3_conn* con_u, u3_noun dat)
         res = u3nc(
           u3_nul,
           u3i_list(u3nc(c3__help, u3_nul), u3nc(c3__info, u3_nul),
+                   u3nc(c3__jets, u3_nul),
                    u3nc(c3__khan, u3_nul), u3nc(c3__live, u3_nul),
-                   u3nc(c3__mass, u3_nul),
+                   u3nc(c3__mass, u3_nul), u3nc(c3__nock, u3_nul),
                    u3nc(c3__port,
                         u3i_list(c3__ames, c3__htls, c3__http, u3_none)),
                    u3nc(c3__v, u3_nul), u3nc(c3__who, u3_nul),
@@ -478,6 +543,16 @@ _conn_read_peel(u3_conn* con_u, u3_noun dat)
         //
         res = u3_nul;
       } break;
+      //  bytecode profile.
+      //
+      case c3__nock: {
+        res = _conn_peel_put(con_u, "nock");
+      } break;
+      //  jet arm metrics.
+      //
+      case c3__jets: {
+        res = _conn_peel_put(con_u, "jets");
+      } break;
       //  runtime metrics.
       //
       case c3__info: {
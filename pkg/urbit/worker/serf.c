@@ -233,6 +233,9 @@ _serf_grab(u3_noun sac)
     u3a_print_memory(fil_u, "free lists", u3a_idle(u3R));
     u3a_print_memory(fil_u, "sweep", u3a_sweep());
 
+    fprintf(fil_u, "\r\n");
+    u3j_damp(fil_u);
+
     fflush(fil_u);
 
 #ifdef U3_MEMORY_LOG
@@ -298,6 +301,47 @@ u3_serf_grab(void)
   fflush(stderr);
 }
 
+/* _serf_put_save(): write [eve dat] to .urb/put/<nam>.jam. RETAIN.
+**
+**   read back by the %peel paths of the control plane.
+*/
+static void
+_serf_put_save(u3_serf* sef_u, const c3_c* nam_c, u3_noun dat)
+{
+  c3_c  pat_c[2048];
+  c3_c  tmp_c[2054];
+  c3_d  len_d;
+  c3_y* byt_y;
+  FILE* fil_u;
+
+  {
+    u3_noun pro = u3nc(u3i_chub(sef_u->dun_d), u3k(dat));
+    u3s_jam_xeno(pro, &len_d, &byt_y);
+    u3z(pro);
+  }
+
+  snprintf(pat_c, 2048, "%s/.urb/put/%s.jam", u3P.dir_c, nam_c);
+  snprintf(tmp_c, 2054, "%s.tmp", pat_c);
+
+  //  write and rename, so that readers never see a partial file
+  //
+  if ( !(fil_u = c3_fopen(tmp_c, "w")) ) {
+    fprintf(stderr, "serf: %s: %s: %s\r\n", nam_c, tmp_c, strerror(errno));
+  }
+  else {
+    c3_t wit_t = ( 1 == fwrite(byt_y, len_d, 1, fil_u) );
+
+    if (  (0 != fclose(fil_u))
+       || !wit_t
+       || (0 != rename(tmp_c, pat_c)) )
+    {
+      fprintf(stderr, "serf: %s: %s: %s\r\n", nam_c, pat_c, strerror(errno));
+    }
+  }
+
+  c3_free(byt_y);
+}
+
 /* u3_serf_post(): update serf state post-writ.
 */
 void
@@ -312,6 +356,13 @@ u3_serf_post(u3_serf* sef_u)
   //
   if ( c3y == sef_u->mut_o ) {
     _serf_grab(sef_u->sac);
+
+    {
+      u3_noun jet = u3j_prof();
+      _serf_put_save(sef_u, "jets", jet);
+      u3z(jet);
+    }
+
     sef_u->sac   = u3_nul;
     sef_u->mut_o = c3n;
   }
@@ -603,6 +654,37 @@ _serf_work(u3_serf* sef_u, c3_w mil_w, u3_noun job)
   }
 }
 
+/* _serf_prof_save(): write the bytecode profile since the last save,
+**                    and the jet metrics so far.
+**
+**   at most once every SERF_PROF_SECS, so that jamming and writing the
+**   profiles doesn't skew the events being profiled.
+*/
+#define SERF_PROF_SECS 10
+
+static void
+_serf_prof_save(u3_serf* sef_u)
+{
+  struct timeval tim_u;
+  u3_noun        pro, jet;
+
+  gettimeofday(&tim_u, 0);
+
+  if ( (c3_d)tim_u.tv_sec < (sef_u->pro_d + SERF_PROF_SECS) ) {
+    return;
+  }
+
+  sef_u->pro_d = tim_u.tv_sec;
+  pro = u3n_prof();
+  jet = u3j_prof();
+
+  _serf_put_save(sef_u, "nock", pro);
+  _serf_put_save(sef_u, "jets", jet);
+
+  u3z(pro);
+  u3z(jet);
+}
+
 /* u3_serf_work(): apply event, producing effects.
 */
 u3_noun
@@ -639,6 +721,10 @@ u3_serf_work(u3_serf* sef_u, c3_w mil_w, u3_noun job)
     u3t_event_trace(lab_c, 'E');
   }
 
+  if ( u3C.wag_w & u3o_debug_cpu ) {
+    _serf_prof_save(sef_u);
+  }
+
   return pro;
 }
 
@@ -848,6 +934,8 @@ _serf_writ_live_exit(u3_serf* sef_u, c3_w cod_w)
     }
 
     u3t_damp(fil_u);
+    u3n_damp(fil_u);
+    u3j_damp(fil_u);
 
     {
       fclose(fil_u);
@@ -1120,6 +1208,7 @@ u3_serf_init(u3_serf* sef_u)
   sef_u->rec_o = c3n;
   sef_u->mut_o = c3n;
   sef_u->sac   = u3_nul;
+  sef_u->pro_d = 0;
 
   return rip;
 }